@@ -7,6 +7,7 @@
 #include <cmath>
 #include <vector>
 #include "../snes9x.h"
+#include "../memmap.h"
 #include "apu.h"
 #include "../msu1.h"
 #include "../snapshot.h"
@@ -26,29 +27,29 @@ static const int APU_DENOMINATOR_PAL    = 709379;
    the APU speedup hack and for a frontend that runs a long frame without
    draining. */
 static const int LANDING_BUFFER_FRAMES = 2048;
-static int16 landing_buffer[LANDING_BUFFER_FRAMES * 2];
+static S9X_TLS int16 landing_buffer[LANDING_BUFFER_FRAMES * 2];
 
 namespace SNES {
 #include "bapu/dsp/blargg_endian.h"
-CPU cpu;
+S9X_TLS CPU cpu;
 } // namespace SNES
 
 namespace spc {
-static apu_callback callback = NULL;
-static void *callback_data = NULL;
+static S9X_TLS apu_callback callback = NULL;
+static S9X_TLS void *callback_data = NULL;
 
-static bool8 sound_in_sync = true;
-static bool8 sound_enabled = false;
+static S9X_TLS bool8 sound_in_sync = true;
+static S9X_TLS bool8 sound_enabled = false;
 
-static int32 reference_time;
-static uint32 remainder;
+static S9X_TLS int32 reference_time;
+static S9X_TLS uint32 remainder;
 
 static const int timing_hack_numerator = 256;
-static int timing_hack_denominator = 256;
+static S9X_TLS int timing_hack_denominator = 256;
 /* Set these to NTSC for now. Will change to PAL in S9xAPUTimingSetSpeedup
    if necessary on game load. */
-static uint32 ratio_numerator = APU_NUMERATOR_NTSC;
-static uint32 ratio_denominator = APU_DENOMINATOR_NTSC;
+static S9X_TLS uint32 ratio_numerator = APU_NUMERATOR_NTSC;
+static S9X_TLS uint32 ratio_denominator = APU_DENOMINATOR_NTSC;
 
 } // namespace spc
 
@@ -144,6 +145,9 @@ void S9xSetSoundMute(bool8 mute)
 
 bool8 S9xInitAPU(void)
 {
+    // The SMP's RAM sits in the memory arena, next to the S-CPU's.
+    SNES::smp.apuram = Memory.Arena->APURAM;
+
     S9xClearSamples();
 
     return true;
@@ -238,10 +242,23 @@ void S9xSoftResetAPU(void)
 }
 
 void S9xAPUSaveState(uint8 *block)
+{
+    memcpy(block, SNES::smp.apuram, 0x10000);
+    S9xAPUSaveRegisters(block + 0x10000);
+}
+
+void S9xAPULoadState(uint8 *block)
+{
+    memcpy(SNES::smp.apuram, block, 0x10000);
+    S9xAPULoadRegisters(block + 0x10000);
+}
+
+// Everything but the RAM, for snapshots that copy the arena themselves.
+void S9xAPUSaveRegisters(uint8 *block)
 {
     uint8 *ptr = block;
 
-    SNES::smp.save_state(&ptr);
+    SNES::smp.save_registers(&ptr);
     SNES::dsp.save_state(&ptr);
 
     SNES::set_le32(ptr, spc::reference_time);
@@ -253,14 +270,14 @@ void S9xAPUSaveState(uint8 *block)
     memcpy(ptr, SNES::cpu.registers, 4);
     ptr += sizeof(int32);
 
-    memset(ptr, 0, SPC_SAVE_STATE_BLOCK_SIZE - (ptr - block));
+    memset(ptr, 0, SPC_REGISTER_BLOCK_SIZE - (ptr - block));
 }
 
-void S9xAPULoadState(uint8 *block)
+void S9xAPULoadRegisters(uint8 *block)
 {
     uint8 *ptr = block;
 
-    SNES::smp.load_state(&ptr);
+    SNES::smp.load_registers(&ptr);
     SNES::dsp.load_state(&ptr);
     spc::reference_time = SNES::get_le32(ptr);
     ptr += sizeof(int32);
@@ -12,6 +12,7 @@
 typedef void (*apu_callback) (void *);
 
 #define SPC_SAVE_STATE_BLOCK_SIZE (1024 * 65)
+#define SPC_REGISTER_BLOCK_SIZE   (SPC_SAVE_STATE_BLOCK_SIZE - 0x10000)
 
 bool8 S9xInitAPU (void);
 void S9xDeinitAPU (void);
@@ -26,6 +27,8 @@ void S9xAPUTimingSetSpeedup (int);
 void S9xAPULoadState (uint8 *);
 void S9xAPULoadBlarggState(uint8 *oldblock);
 void S9xAPUSaveState (uint8 *);
+void S9xAPULoadRegisters (uint8 *);
+void S9xAPUSaveRegisters (uint8 *);
 
 bool8 S9xInitSound (int);
 
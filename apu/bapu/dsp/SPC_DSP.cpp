@@ -1,6 +1,7 @@
 // snes_spc 0.9.0. http://www.slack.net/~ant/
 
 #include "../../../snes9x.h"
+#include "../../../dirty.h"
 
 #include "SPC_DSP.h"
 
@@ -1090,7 +1091,11 @@ ECHO_CLOCK( 28 )
 inline void SPC_DSP::echo_write( int ch )
 {
 	if ( !(m.t_echo_enabled & 0x20) )
+	{
 		SET_LE16A( ECHO_PTR( ch ), m.t_echo_out [ch] );
+		if ( !Settings.SeparateEchoBuffer )
+			S9xDirtyARAM( (m.t_echo_ptr + ch * 2) & 0xFFFF );
+	}
 
 	m.t_echo_out [ch] = 0;
 }
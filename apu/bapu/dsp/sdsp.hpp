@@ -26,9 +26,7 @@ public:
   void power();
   void reset();
 
-  DSP();
-
   SPC_DSP spc_dsp;
 };
 
-extern DSP dsp;
+extern S9X_TLS DSP dsp;
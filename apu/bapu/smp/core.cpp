@@ -35,6 +35,7 @@ void SMP::op_write(uint16 addr, uint8 data) {
   tick();
   if((addr & 0xfff0) == 0x00f0) mmio_write(addr, data);
   apuram[addr] = data;  //all writes go to RAM, even MMIO writes
+  S9xDirtyARAM(addr);
 }
 
 uint8 SMP::op_readstack()
@@ -46,6 +47,7 @@ uint8 SMP::op_readstack()
 void SMP::op_writestack(uint8 data)
 {
   tick();
+  S9xDirtyARAM(0x0100 | regs.sp);
   apuram[0x0100 | regs.sp--] = data;
 }
 
@@ -1,7 +1,7 @@
 #ifdef DEBUGGER
 #include "../../../snes9x.h"
 #include "../../../debug.h"
-char tmp[1024];
+S9X_TLS char tmp[1024];
 #endif
 
 #include "../snes/snes.hpp"
@@ -13,7 +13,7 @@ namespace SNES {
 #include "debugger/disassembler.cpp"
 #endif
 
-SMP smp;
+S9X_TLS SMP smp;
 
 #include "algorithms.cpp"
 #include "core.cpp"
@@ -65,12 +65,5 @@ void SMP::reset() {
   timer0.stage3_ticks = timer1.stage3_ticks = timer2.stage3_ticks = 0;
 }
 
-SMP::SMP() {
-  apuram = new uint8[64 * 1024];
-}
-
-SMP::~SMP() {
-	delete[] apuram;
-}
-
+// apuram is owned by Memory.Arena; S9xInitAPU points it there.
 }
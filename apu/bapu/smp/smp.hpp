@@ -15,8 +15,8 @@ public:
 
   void load_state(uint8 **);
   void save_state(uint8 **);
-  SMP();
-  ~SMP();
+  void load_registers(uint8 **);
+  void save_registers(uint8 **);
 
 //private:
   struct Flags {
@@ -122,4 +122,4 @@ public:
 #endif
 };
 
-extern SMP smp;
+extern S9X_TLS SMP smp;
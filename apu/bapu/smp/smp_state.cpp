@@ -6,9 +6,13 @@ namespace SNES {
 #include "../dsp/blargg_endian.h"
 
 void SMP::save_state(uint8 **block) {
+  memcpy(*block, apuram, 64 * 1024);
+  *block += 64 * 1024;
+  save_registers(block);
+}
+
+void SMP::save_registers(uint8 **block) {
   uint8 *ptr = *block;
-  memcpy(ptr, apuram, 64 * 1024);
-  ptr += 64 * 1024;
 
 #undef INT32
 #define INT32(i) set_le32(ptr, (i)); ptr += sizeof(int32)
@@ -68,9 +72,13 @@ void SMP::save_state(uint8 **block) {
 }
 
 void SMP::load_state(uint8 **block) {
+  memcpy(apuram, *block, 64 * 1024);
+  *block += 64 * 1024;
+  load_registers(block);
+}
+
+void SMP::load_registers(uint8 **block) {
   uint8 *ptr = *block;
-  memcpy(apuram, ptr, 64 * 1024);
-  ptr += 64 * 1024;
 
 #undef INT32
 #define INT32(i) i = get_le32(ptr); ptr += sizeof(int32)
@@ -4,6 +4,7 @@
 #include "../../../snes9x.h"
 #include "../../resampler.h"
 #include "../../../msu1.h"
+#include "../../../dirty.h"
 
 #define debugvirtual
 
@@ -40,7 +41,7 @@ public:
     }
 };
 
-extern CPU cpu;
+extern S9X_TLS CPU cpu;
 
 } // namespace SNES
 
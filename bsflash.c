@@ -11,7 +11,7 @@
 #include "port.h"
 #include "bsflash.h"
 
-struct BSFlash	BSFlashChip;
+S9X_TLS struct BSFlash	BSFlashChip;
 
 /* Block geometry: 16-bit blocks (65536 bytes each), like ares. */
 #define BSF_BLOCK_BITS   16
@@ -96,7 +96,7 @@ struct BSFlash
 	int		 erase_block;    /* block id currently erasing, -1 = none */
 };
 
-extern struct BSFlash	BSFlashChip;
+extern S9X_TLS struct BSFlash	BSFlashChip;
 
 /* Lifecycle */
 void	S9xBSFlashInit (uint8_t *memory, uint32_t size, uint8_t is_rom);
@@ -44,14 +44,14 @@ static int bsx_stream_get (RFILE *f)
 }
 
 /* Bridges to the C++ side, set from memmap.cpp. */
-uint8_t  **BSXMemMap        = 0;   /* = Memory.Map */
-uint8_t   *BSXBlockIsRAM    = 0;   /* = Memory.BlockIsRAM */
-uint8_t   *BSXBlockIsROM    = 0;   /* = Memory.BlockIsROM */
-uint8_t   *BSXRAMBase       = 0;   /* = Memory.RAM */
-uint8_t   *BSXSRAMBase      = 0;   /* = Memory.SRAM */
-uint8_t   *BSXPSRAMBase     = 0;   /* = Memory.BSRAM */
-uint8_t   *BSXBIOSROMBase   = 0;   /* = Memory.BIOSROM */
-uint8_t   *BSXROMBase       = 0;   /* = BSXROMBase */
+S9X_TLS uint8_t  **BSXMemMap        = 0;   /* = Memory.Map */
+S9X_TLS uint8_t   *BSXBlockIsRAM    = 0;   /* = Memory.BlockIsRAM */
+S9X_TLS uint8_t   *BSXBlockIsROM    = 0;   /* = Memory.BlockIsROM */
+S9X_TLS uint8_t   *BSXRAMBase       = 0;   /* = Memory.RAM */
+S9X_TLS uint8_t   *BSXSRAMBase      = 0;   /* = Memory.SRAM */
+S9X_TLS uint8_t   *BSXPSRAMBase     = 0;   /* = Memory.BSRAM */
+S9X_TLS uint8_t   *BSXBIOSROMBase   = 0;   /* = Memory.BIOSROM */
+S9X_TLS uint8_t   *BSXROMBase       = 0;   /* = BSXROMBase */
 
 /* Implemented extern "C" in memmap.cpp. */
 extern void        BSXMapWriteProtectROM (void);
@@ -67,7 +67,7 @@ extern const char *BSXGetSlashStr (void);
 extern uint32_t    BSXGetCalculatedSize (void);
 extern uint32_t    BSXGetCartOffsetB (void);
 extern void        BSXSetSRAMInitialValue (uint8_t v);
-extern uint8_t     OpenBus;
+extern S9X_TLS uint8_t     OpenBus;
 
 /*#define BSX_DEBUG */
 
@@ -104,7 +104,7 @@ struct SBSX_RTC
 	int	ticks;
 };
 
-static struct SBSX_RTC	BSX_RTC;
+static S9X_TLS struct SBSX_RTC	BSX_RTC;
 
 /* flash card vendor information */
 static const uint8	flashcard[20] =
@@ -133,9 +133,9 @@ static const uint8	init2192[32] =	/* FIXME */
 };
 #endif
 
-static bool8	FlashMode;
-static uint32	FlashSize;
-static uint8	*MapROM, *FlashROM;
+static S9X_TLS bool8	FlashMode;
+static S9X_TLS uint32	FlashSize;
+static S9X_TLS uint8	*MapROM, *FlashROM;
 
 static void BSX_Map_SNES (void);
 static void BSX_Map_LoROM (void);
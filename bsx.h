@@ -16,14 +16,14 @@ extern "C" {
 #endif
 
 /* Bridges to the C++ side (defined in bsx.c, wired in memmap.cpp). */
-extern uint8_t **BSXMemMap;
-extern uint8_t  *BSXBlockIsRAM;
-extern uint8_t  *BSXBlockIsROM;
-extern uint8_t  *BSXRAMBase;
-extern uint8_t  *BSXSRAMBase;
-extern uint8_t  *BSXPSRAMBase;
-extern uint8_t  *BSXBIOSROMBase;
-extern uint8_t  *BSXROMBase;
+extern S9X_TLS uint8_t **BSXMemMap;
+extern S9X_TLS uint8_t  *BSXBlockIsRAM;
+extern S9X_TLS uint8_t  *BSXBlockIsROM;
+extern S9X_TLS uint8_t  *BSXRAMBase;
+extern S9X_TLS uint8_t  *BSXSRAMBase;
+extern S9X_TLS uint8_t  *BSXPSRAMBase;
+extern S9X_TLS uint8_t  *BSXBIOSROMBase;
+extern S9X_TLS uint8_t  *BSXROMBase;
 
 
 struct SBSX
@@ -61,7 +61,7 @@ struct SBSX
 	uint16	sat_stream1_queue, sat_stream2_queue;
 };
 
-extern struct SBSX	BSX;
+extern S9X_TLS struct SBSX	BSX;
 
 uint8 S9xGetBSX (uint32);
 void S9xSetBSX (uint8, uint32);
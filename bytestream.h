@@ -7,15 +7,14 @@
 /* A cursor over a byte buffer, which is all the Stream class hierarchy was
    ever used for here once file-backed savestates went away:
 
-     - savestates are written to and read from a caller-supplied buffer
-       (retro_serialize / retro_unserialize)
-     - S9xFreezeSize measures a savestate by writing with no buffer at all
+     - version 1 savestates, the block stream, are read from the buffer
+       handed to retro_unserialize
      - patches are read from a buffer, whether that came from a loose file,
        a zip entry or an .msu1 pack member
 
-   Passing buf = NULL makes writes count bytes without storing them, which is
-   the sizing pass. Reads past the end return short, and seeks are clamped, so
-   a truncated or malformed input cannot walk off the buffer. */
+   Passing buf = NULL makes writes count bytes without storing them. Reads
+   past the end return short, and seeks are clamped, so a truncated or
+   malformed input cannot walk off the buffer. */
 
 #ifndef _BYTESTREAM_H_
 #define _BYTESTREAM_H_
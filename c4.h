@@ -185,8 +185,8 @@
 extern "C" {
 #endif
 
-extern uint8_t *C4RAMBase;
-extern uint8_t *C4ROMBase;
+extern S9X_TLS uint8_t *C4RAMBase;
+extern S9X_TLS uint8_t *C4ROMBase;
 
 void S9xInitC4 (void);
 void S9xSetC4 (uint8_t, uint16_t);
@@ -186,28 +186,28 @@
 #include "port.h"
 #include "c4.h"
 
-uint8_t *C4RAMBase = 0;
-uint8_t *C4ROMBase = 0;
+S9X_TLS uint8_t *C4RAMBase = 0;
+S9X_TLS uint8_t *C4ROMBase = 0;
 
 #ifndef SAR
 #define SAR(b, n)	((b) >> (n))
 #endif
 
-static int16_t	C4WFXVal;
-static int16_t	C4WFYVal;
-static int16_t	C4WFZVal;
-static int16_t	C4WFX2Val;
-static int16_t	C4WFY2Val;
-static int16_t	C4WFDist;
-static int16_t	C4WFScale;
-static int16_t	C41FXVal;
-static int16_t	C41FYVal;
-static int16_t	C41FAngleRes;
-static int16_t	C41FDist;
-static int16_t	C41FDistVal;
-
-static int64_t	c4x, c4y, c4z;		/* Q16 fixed-point wireframe coords */
-static int64_t	c4x2, c4y2, c4z2;
+static S9X_TLS int16_t	C4WFXVal;
+static S9X_TLS int16_t	C4WFYVal;
+static S9X_TLS int16_t	C4WFZVal;
+static S9X_TLS int16_t	C4WFX2Val;
+static S9X_TLS int16_t	C4WFY2Val;
+static S9X_TLS int16_t	C4WFDist;
+static S9X_TLS int16_t	C4WFScale;
+static S9X_TLS int16_t	C41FXVal;
+static S9X_TLS int16_t	C41FYVal;
+static S9X_TLS int16_t	C41FAngleRes;
+static S9X_TLS int16_t	C41FDist;
+static S9X_TLS int16_t	C41FDistVal;
+
+static S9X_TLS int64_t	c4x, c4y, c4z;		/* Q16 fixed-point wireframe coords */
+static S9X_TLS int64_t	c4x2, c4y2, c4z2;
 
 static int16_t	C4SinTable[512] =
 {
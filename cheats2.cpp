@@ -104,6 +104,7 @@ static inline void S9xSetByteFree(uint8 Byte, uint32 Address)
     if (SetAddress >= (uint8 *)CMemory::MAP_LAST)
     {
         *(SetAddress + (Address & 0xffff)) = Byte;
+        S9xDirtyMapped(SetAddress + (Address & 0xffff));
         return;
     }
 
@@ -16,9 +16,70 @@ static uint8	region_map[6][6] =
 	{ 0,    0,    0,    0,    0, 0x10 }
 };
 
+// Window inputs that S9xComputeClipWindows reads. RecomputeClipWindows is
+// raised by writes that cannot change the result (TM/TS, the frame start)
+// and HDMA window effects tend to cycle through a handful of shapes, so
+// the result is keyed on these and reused. Layer[5] is the colour window;
+// it and the window positions feed every layer's regions.
+struct ClipKey
+{
+	uint8	Window[4];	// Window1Left, Window1Right, Window2Left, Window2Right
+	uint8	Layer[6];	// enables, inside flags and overlap logic
+	uint8	TMW, TSW;	// $212e, $212f
+	uint8	CGWSEL;		// $2130, colour window bits
+	uint8	Pad[3];
+};
+
+#define CLIP_CACHE_SIZE	16
+
+static S9X_TLS struct
+{
+	struct ClipKey	Key;
+	bool8			Valid;
+	struct ClipData	Clip[2][6];
+}	ClipCache[CLIP_CACHE_SIZE];
+
+static S9X_TLS struct ClipKey	ClipCurrent;	// what IPPU.Clip holds now
+static S9X_TLS bool8			ClipCurrentValid = FALSE;
+
 static inline uint8 CalcWindowMask (int, uint8, uint8);
 static inline void StoreWindowRegions (uint8, struct ClipData *, int, int16 *, uint8 *, bool8, bool8 s = FALSE);
 
+static void BuildClipKey (struct ClipKey *k)
+{
+	memset(k, 0, sizeof(struct ClipKey));
+
+	k->Window[0] = PPU.Window1Left;
+	k->Window[1] = PPU.Window1Right;
+	k->Window[2] = PPU.Window2Left;
+	k->Window[3] = PPU.Window2Right;
+
+	for (int i = 0; i < 6; i++)
+		k->Layer[i] = (PPU.ClipWindow1Enable[i] ? 0x01 : 0) | (PPU.ClipWindow2Enable[i] ? 0x02 : 0) |
+					  (PPU.ClipWindow1Inside[i] ? 0x04 : 0) | (PPU.ClipWindow2Inside[i] ? 0x08 : 0) |
+					  ((PPU.ClipWindowOverlapLogic[i] & 3) << 4);
+
+	k->TMW    = Memory.FillRAM[0x212e] & 0x1f;
+	k->TSW    = Memory.FillRAM[0x212f] & 0x1f;
+	k->CGWSEL = Memory.FillRAM[0x2130] & 0xf0;
+}
+
+static inline uint32 HashClipKey (const struct ClipKey *k)
+{
+	const uint8	*p = (const uint8 *) k;
+	uint32		h = 2166136261u;
+
+	for (unsigned i = 0; i < sizeof(struct ClipKey); i++)
+		h = (h ^ p[i]) * 16777619u;
+
+	return ((h ^ (h >> 16)) & (CLIP_CACHE_SIZE - 1));
+}
+
+void S9xInvalidateClipWindows (void)
+{
+	ClipCurrentValid = FALSE;
+}
+
 
 static inline uint8 CalcWindowMask (int i, uint8 W1, uint8 W2)
 {
@@ -106,6 +167,28 @@ void S9xComputeClipWindows (void)
 	int		n_regions = 1;
 	int		i, j;
 
+	struct ClipKey	key;
+	BuildClipKey(&key);
+
+	if (ClipCurrentValid && !memcmp(&key, &ClipCurrent, sizeof(struct ClipKey)))
+		return;
+
+	uint32	slot = HashClipKey(&key);
+
+	if (ClipCache[slot].Valid && !memcmp(&key, &ClipCache[slot].Key, sizeof(struct ClipKey)))
+	{
+		memcpy(IPPU.Clip, ClipCache[slot].Clip, sizeof(IPPU.Clip));
+		ClipCurrent = key;
+		ClipCurrentValid = TRUE;
+		return;
+	}
+
+	// Regions shared by every layer are unchanged: only layers whose own
+	// window settings or TMW/TSW bits differ need to be stored again.
+	bool8	shared = ClipCurrentValid &&
+					 !memcmp(key.Window, ClipCurrent.Window, sizeof(key.Window)) &&
+					 key.Layer[5] == ClipCurrent.Layer[5] && key.CGWSEL == ClipCurrent.CGWSEL;
+
 	// Calculate window regions. We have at most 5 regions, because we have 6 control points
 	// (screen edges, window 1 left & right, and window 2 left & right).
 
@@ -215,13 +298,20 @@ void S9xComputeClipWindows (void)
 
 	// Store backdrop clip window (draw everywhere color window allows)
 
-	StoreWindowRegions(0, &IPPU.Clip[0][5], n_regions, windows, drawing_modes, FALSE, TRUE);
-	StoreWindowRegions(0, &IPPU.Clip[1][5], n_regions, windows, drawing_modes, TRUE,  TRUE);
+	if (!shared)
+	{
+		StoreWindowRegions(0, &IPPU.Clip[0][5], n_regions, windows, drawing_modes, FALSE, TRUE);
+		StoreWindowRegions(0, &IPPU.Clip[1][5], n_regions, windows, drawing_modes, TRUE,  TRUE);
+	}
 
 	// Store per-BG and OBJ clip windows
 
 	for (j = 0; j < 5; j++)
 	{
+		if (shared && key.Layer[j] == ClipCurrent.Layer[j] &&
+			!(((key.TMW ^ ClipCurrent.TMW) | (key.TSW ^ ClipCurrent.TSW)) & (1 << j)))
+			continue;
+
 		uint8	W = CalcWindowMask(j, W1, W2);
 		for (int sub = 0; sub < 2; sub++)
 		{
@@ -231,4 +321,10 @@ void S9xComputeClipWindows (void)
 				StoreWindowRegions(0, &IPPU.Clip[sub][j], n_regions, windows, drawing_modes, sub);
 		}
 	}
+
+	ClipCurrent = key;
+	ClipCurrentValid = TRUE;
+	ClipCache[slot].Key = key;
+	ClipCache[slot].Valid = TRUE;
+	memcpy(ClipCache[slot].Clip, IPPU.Clip, sizeof(IPPU.Clip));
 }
@@ -62,8 +62,8 @@ using namespace	std;
 #define FLAG_IOBIT1				(Memory.FillRAM[0x4213] & 0x80)
 #define FLAG_IOBIT(n)			((n) ? (FLAG_IOBIT1) : (FLAG_IOBIT0))
 
-bool8	pad_read = 0, pad_read_last = 0;
-uint8	read_idx[2 /* ports */][2 /* per port */];
+S9X_TLS bool8	pad_read = 0, pad_read_last = 0;
+S9X_TLS uint8	read_idx[2 /* ports */][2 /* per port */];
 
 struct exemulti
 {
@@ -79,12 +79,12 @@ struct crosshair
 	uint8				fg, bg;
 };
 
-static struct
+static S9X_TLS struct
 {
 	uint16				buttons;
 }	joypad[8];
 
-static struct
+static S9X_TLS struct
 {
 	uint8				delta_x, delta_y;
 	int16				old_x, old_y;
@@ -94,7 +94,7 @@ static struct
 	struct crosshair	crosshair;
 }	mouse[2];
 
-static struct
+static S9X_TLS struct
 {
 	int16				x, y;
 	uint8				phys_buttons;
@@ -104,7 +104,7 @@ static struct
 	struct crosshair	crosshair;
 }	superscope;
 
-static struct
+static S9X_TLS struct
 {
 	int16				x[2], y[2];
 	uint8				buttons;
@@ -113,12 +113,12 @@ static struct
 	struct crosshair	crosshair[2];
 }	justifier;
 
-static struct
+static S9X_TLS struct
 {
 	int8				pads[4];
 }	mp5[2];
 
-static struct
+static S9X_TLS struct
 {
 	int16				x, y;
 	uint8				buttons;
@@ -126,13 +126,13 @@ static struct
 	struct crosshair	crosshair;
 }	macsrifle;
 
-static set<struct exemulti *>		exemultis;
-static map<uint32, s9xcommand_t>	keymap;
-static vector<s9xcommand_t *>		multis;
-static bool8						FLAG_LATCH = FALSE;
-static int32						curcontrollers[2] = { NONE,    NONE };
-static int32						newcontrollers[2] = { JOYPAD0, NONE };
-static char							buf[256];
+static S9X_TLS_OBJECT set<struct exemulti *>		exemultis;
+static S9X_TLS_OBJECT map<uint32, s9xcommand_t>	keymap;
+static S9X_TLS_OBJECT vector<s9xcommand_t *>		multis;
+static S9X_TLS bool8						FLAG_LATCH = FALSE;
+static S9X_TLS int32						curcontrollers[2] = { NONE,    NONE };
+static S9X_TLS int32						newcontrollers[2] = { JOYPAD0, NONE };
+static S9X_TLS char							buf[256];
 
 static const char	*color_names[32] =
 {
@@ -1192,6 +1192,8 @@ void S9xSetJoypadLatch (bool latch)
 	{
 		int	i;
 
+		S9xOnSNESPadLatch();
+
 		for (int n = 0; n < 2; n++)
 		{
 			for (int j = 0; j < 2; j++)
@@ -135,6 +135,11 @@ void S9xApplyCommand (s9xcommand_t cmd, int16 data1, int16 data2);
 //////////
 // These functions are called by snes9x into your port, so each port should implement them.
 
+// Called when the game latches the controllers (a $4016 strobe or the auto-joypad read), before any
+// controller state is taken. A port can poll its input here rather than ahead of the frame.
+
+void S9xOnSNESPadLatch (void);
+
 // Called before already-read SNES joypad data is being used by the game if your port defines SNES_JOY_READ_CALLBACKS.
 
 #ifdef SNES_JOY_READ_CALLBACKS
@@ -12,6 +12,7 @@
 #include "sdd1.h"
 #include "srtc.h"
 #include "snapshot.h"
+#include "dirty.h"
 #include "cheats.h"
 #ifdef DEBUGGER
 #include "debug.h"
@@ -97,8 +98,8 @@ static void S9xSoftResetCPU (void)
 void S9xReset (void)
 {
 
-	memset(Memory.RAM, 0x55, sizeof(Memory.RAM));
-	memset(Memory.VRAM, 0x00, sizeof(Memory.VRAM));
+	memset(Memory.RAM, 0x55, sizeof(SArena::RAM));
+	memset(Memory.VRAM, 0x00, sizeof(SArena::VRAM));
 	memset(Memory.FillRAM, 0, 0x8000);
 
 	S9xResetBSX();
@@ -107,6 +108,7 @@ void S9xReset (void)
 	S9xResetDMA();
 	S9xResetAPU();
     S9xResetMSU1();
+	S9xDirtyAll();
 
 	if (Settings.DSP)
 		S9xResetDSP();
@@ -143,6 +145,7 @@ void S9xSoftReset (void)
 	S9xResetDMA();
 	S9xSoftResetAPU();
     S9xResetMSU1();
+	S9xDirtyAll();
 
 	if (Settings.DSP)
 		S9xResetDSP();
@@ -47,8 +47,10 @@ enum crosscontrols
 
 void S9xSetControllerCrosshair (enum crosscontrols ctl, int8 idx, const char *fg, const char *bg);
 
-// In gfx.cpp, much like S9xDisplayChar() except it takes the parameters
-// listed and looks up GFX.Screen.
+// In gfx.cpp. Puts a crosshair over the frame being ended, at x, y in SNES
+// pixels. It is not drawn into GFX.Screen there and then but queued, and
+// the port draws the queue over the frame with S9xDrawCrosshairs() once the
+// frame has its final rows (after S9xMode7VertResample()).
 // The 'crosshair' arg is a 15x15 image, with '#' meaning fgcolor,
 // '.' meaning bgcolor, and anything else meaning transparent.
 // Color values should be (RGB):
@@ -60,4 +62,25 @@ void S9xSetControllerCrosshair (enum crosscontrols ctl, int8 idx, const char *fg
 
 void S9xDrawCrosshair (const char *crosshair, uint8 fgcolor, uint8 bgcolor, int16 x, int16 y);
 
+struct SCrosshairs
+{
+	int		Count;
+	int		Lines;				// PPU.ScreenHeight of the frame
+	struct
+	{
+		const char	*Image;
+		uint8		FG, BG;
+		int16		X, Y;
+	}	Item[4];
+};
+
+// The crosshairs queued for the frame last handed to S9xDeinitUpdate(). A
+// port that draws them later takes a copy.
+const struct SCrosshairs * S9xFrameCrosshairs (void);
+
+// Draws crosshairs over a frame laid out like GFX.Screen, rows ppl apart,
+// width by height pixels; each SNES pixel is width / SNES_WIDTH pixels wide
+// and height / crosshairs->Lines tall.
+void S9xDrawCrosshairs (uint16 *screen, uint32 ppl, int width, int height, const struct SCrosshairs *crosshairs);
+
 #endif
@@ -0,0 +1,64 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+/* Dirty-page stamps for delta snapshots (S9xFreezeDelta).
+
+   Each 256-byte page of the large snapshot blocks carries the value of
+   Dirty.Serial at the time it last changed. A delta against a baseline then
+   holds only the pages stamped after that baseline's serial.
+
+   WRAM, VRAM and APU RAM are stamped from their write paths: the CPU bus
+   writes in getset.h, $2180, STORE_VRAM, the SMP's stores and the DSP's echo
+   writes. SRAM and FillRAM are written from too many places to hook - every
+   coprocessor, the register handlers, the frontend through
+   retro_get_memory_data - so snapshot.cpp stamps those by comparing against
+   a shadow copy whenever a baseline or a delta is taken. WRAM and VRAM join
+   them once retro_get_memory_data has handed either out, as the frontend's
+   cheats and memory viewers then write it behind the hooks. */
+
+#ifndef _DIRTY_H_
+#define _DIRTY_H_
+
+#include "port.h"
+
+#define DIRTY_PAGE_SHIFT	8
+#define DIRTY_PAGE_SIZE		(1 << DIRTY_PAGE_SHIFT)
+
+struct SDirtyPages
+{
+	uint32	Serial;
+	uint32	RAM[0x20000 >> DIRTY_PAGE_SHIFT];
+	uint32	VRAM[0x10000 >> DIRTY_PAGE_SHIFT];
+	uint32	ARAM[0x10000 >> DIRTY_PAGE_SHIFT];
+	uint32	SRAM[0x80000 >> DIRTY_PAGE_SHIFT];
+	uint32	FillRAM[0x8000 >> DIRTY_PAGE_SHIFT];
+};
+
+extern S9X_TLS struct SDirtyPages	Dirty;
+
+static inline void S9xDirtyRAM (uint32 offset)
+{
+	Dirty.RAM[offset >> DIRTY_PAGE_SHIFT] = Dirty.Serial;
+}
+
+static inline void S9xDirtyVRAM (uint32 offset)
+{
+	Dirty.VRAM[offset >> DIRTY_PAGE_SHIFT] = Dirty.Serial;
+}
+
+static inline void S9xDirtyARAM (uint32 offset)
+{
+	Dirty.ARAM[offset >> DIRTY_PAGE_SHIFT] = Dirty.Serial;
+}
+
+// Everything counts as changed: after a reset or a snapshot load.
+void S9xDirtyAll (void);
+
+// memory (Memory.RAM or Memory.VRAM) has been handed out, and is stamped by
+// comparison from now on.
+void S9xDirtyUnhooked (const uint8 *memory);
+
+#endif
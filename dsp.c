@@ -189,8 +189,8 @@
 #define FALSE 0
 #endif
 
-uint8_t	(*GetDSP) (uint16_t)        = NULL;
-void	(*SetDSP) (uint8_t, uint16_t) = NULL;
+S9X_TLS uint8_t	(*GetDSP) (uint16_t)        = NULL;
+S9X_TLS void	(*SetDSP) (uint8_t, uint16_t) = NULL;
 
 
 void S9xResetDSP (void)
@@ -2226,7 +2226,7 @@ uint8_t DSP2GetByte (uint16_t address)
  DSP3
 ***********************************************************************************/
 
-static void (*SetDSP3) (void);
+static S9X_TLS void (*SetDSP3) (void);
 
 static const uint16_t	DSP3_DataROM[1024] =
 {
@@ -602,11 +602,11 @@ struct SDSP4
 	int16_t	OAM_Row[32];			/* current number of tiles per row */
 };
 
-extern struct SDSP0	DSP0;
-extern struct SDSP1	DSP1;
-extern struct SDSP2	DSP2;
-extern struct SDSP3	DSP3;
-extern struct SDSP4	DSP4;
+extern S9X_TLS struct SDSP0	DSP0;
+extern S9X_TLS struct SDSP1	DSP1;
+extern S9X_TLS struct SDSP2	DSP2;
+extern S9X_TLS struct SDSP3	DSP3;
+extern S9X_TLS struct SDSP4	DSP4;
 
 uint8_t S9xGetDSP (uint16_t);
 void S9xSetDSP (uint8_t, uint16_t);
@@ -621,8 +621,8 @@ uint8_t DSP4GetByte (uint16_t);
 void DSP4SetByte (uint8_t, uint16_t);
 void DSP3_Reset (void);
 
-extern uint8_t (*GetDSP) (uint16_t);
-extern void (*SetDSP) (uint8_t, uint16_t);
+extern S9X_TLS uint8_t (*GetDSP) (uint16_t);
+extern S9X_TLS void (*SetDSP) (uint8_t, uint16_t);
 
 #ifdef __cplusplus
 }
@@ -132,6 +132,150 @@ void snes_ntsc_init( snes_ntsc_t* ntsc, snes_ntsc_setup_t const* setup )
 
 #ifndef SNES_NTSC_NO_BLITTERS
 
+/* Vector chunk kernel for the 16-bit blitters. Each chunk's seven outputs
+(plus one padding lane, rewritten by the next chunk or the final pixels) are
+summed two table entries per register. Only the low 32 bits of an entry can
+reach the clamp and the output shifts, so the sums are narrowed to 32-bit
+lanes before clamping and the result matches the scalar macros exactly.
+Needs 64-bit snes_ntsc_rgb_t so that a pair of outputs is one load. */
+#if !defined(SNES_NTSC_NO_SIMD) && SNES_NTSC_OUT_DEPTH == 16 && defined(__LP64__) && \
+		(defined(__SSE2__) || defined(__aarch64__))
+	#define SNES_NTSC_SIMD 1
+#else
+	#define SNES_NTSC_SIMD 0
+#endif
+
+#if SNES_NTSC_SIMD && defined(__SSE2__)
+	#include <emmintrin.h>
+
+	typedef __m128i ntsc_pair_t; /* two table entries */
+	typedef __m128i ntsc_quad_t; /* four 32-bit sums */
+
+	#define NTSC_LOAD( p )       _mm_loadu_si128( (__m128i const*) (p) )
+	#define NTSC_LOAD_SPLIT( p, q ) \
+		_mm_unpacklo_epi64( _mm_loadl_epi64( (__m128i const*) (p) ), _mm_loadl_epi64( (__m128i const*) (q) ) )
+	#define NTSC_ADD( a, b )     _mm_add_epi64( a, b )
+	#define NTSC_NARROW( a, b ) \
+		_mm_unpacklo_epi64( _mm_shuffle_epi32( a, _MM_SHUFFLE( 3, 1, 2, 0 ) ), \
+				_mm_shuffle_epi32( b, _MM_SHUFFLE( 3, 1, 2, 0 ) ) )
+	#define NTSC_SHR( v, n )     _mm_srli_epi32( v, n )
+	#define NTSC_AND( a, b )     _mm_and_si128( a, b )
+	#define NTSC_OR( a, b )      _mm_or_si128( a, b )
+	#define NTSC_SUB( a, b )     _mm_sub_epi32( a, b )
+	#define NTSC_SET( n )        _mm_set1_epi32( (int) (n) )
+
+	/* no unsigned 32->16 pack in SSE2; bias into signed range and back */
+	static void ntsc_store( snes_ntsc_out_t* out, ntsc_quad_t lo, ntsc_quad_t hi )
+	{
+		__m128i const bias = _mm_set1_epi32( 0x8000 );
+		__m128i packed = _mm_packs_epi32( _mm_sub_epi32( lo, bias ), _mm_sub_epi32( hi, bias ) );
+		_mm_storeu_si128( (__m128i*) out, _mm_xor_si128( packed, _mm_set1_epi16( (short) 0x8000 ) ) );
+	}
+#elif SNES_NTSC_SIMD
+	#include <arm_neon.h>
+
+	typedef uint64x2_t ntsc_pair_t;
+	typedef uint32x4_t ntsc_quad_t;
+
+	#define NTSC_LOAD( p )       vld1q_u64( (uint64_t const*) (p) )
+	#define NTSC_LOAD_SPLIT( p, q ) \
+		vcombine_u64( vld1_u64( (uint64_t const*) (p) ), vld1_u64( (uint64_t const*) (q) ) )
+	#define NTSC_ADD( a, b )     vaddq_u64( a, b )
+	#define NTSC_NARROW( a, b )  vcombine_u32( vmovn_u64( a ), vmovn_u64( b ) )
+	#define NTSC_SHR( v, n )     vshrq_n_u32( v, n )
+	#define NTSC_AND( a, b )     vandq_u32( a, b )
+	#define NTSC_OR( a, b )      vorrq_u32( a, b )
+	#define NTSC_SUB( a, b )     vsubq_u32( a, b )
+	#define NTSC_SET( n )        vdupq_n_u32( (uint32_t) (n) )
+
+	static void ntsc_store( snes_ntsc_out_t* out, ntsc_quad_t lo, ntsc_quad_t hi )
+	{
+		vst1q_u16( out, vcombine_u16( vmovn_u32( lo ), vmovn_u32( hi ) ) );
+	}
+#endif
+
+#if SNES_NTSC_SIMD
+	/* SNES_NTSC_CLAMP_ followed by the 16-bit case of SNES_NTSC_RGB_OUT_ */
+	#define NTSC_CLAMP_OUT( raw, shift ) {\
+		ntsc_quad_t sub_ = NTSC_AND( NTSC_SHR( raw, 9 - (shift) ), NTSC_SET( snes_ntsc_clamp_mask ) );\
+		ntsc_quad_t clamp_ = NTSC_SUB( NTSC_SET( snes_ntsc_clamp_add ), sub_ );\
+		raw = NTSC_OR( raw, clamp_ );\
+		clamp_ = NTSC_SUB( clamp_, sub_ );\
+		raw = NTSC_AND( raw, clamp_ );\
+		raw = NTSC_OR( NTSC_OR(\
+				NTSC_AND( NTSC_SHR( raw, 13 - (shift) ), NTSC_SET( 0xF800 ) ),\
+				NTSC_AND( NTSC_SHR( raw,  8 - (shift) ), NTSC_SET( 0x07E0 ) ) ),\
+				NTSC_AND( NTSC_SHR( raw,  4 - (shift) ), NTSC_SET( 0x001F ) ) );\
+	}
+
+	#define NTSC_SUM2( a, b )             NTSC_ADD( a, b )
+	#define NTSC_SUM6( a, b, c, d, e, f ) \
+		NTSC_ADD( NTSC_ADD( NTSC_ADD( a, b ), NTSC_ADD( c, d ) ), NTSC_ADD( e, f ) )
+
+	/* Terms are those of SNES_NTSC_RGB_OUT_14_ with the kernels each output
+	sees resolved: k = kernel before the chunk, x = kernelx before the chunk,
+	n = kernel read by this chunk. */
+	static void ntsc_chunk( snes_ntsc_out_t* out,
+			snes_ntsc_rgb_t const* n0, snes_ntsc_rgb_t const* k0,
+			snes_ntsc_rgb_t const* n1, snes_ntsc_rgb_t const* k1, snes_ntsc_rgb_t const* x1,
+			snes_ntsc_rgb_t const* n2, snes_ntsc_rgb_t const* k2, snes_ntsc_rgb_t const* x2 )
+	{
+		ntsc_pair_t p0 = NTSC_SUM6( NTSC_LOAD( n0 + 0 ), NTSC_LOAD( k0 +  7 ),
+				NTSC_LOAD( k1 + 19 ), NTSC_LOAD( x1 + 26 ), NTSC_LOAD( k2 + 31 ), NTSC_LOAD( x2 + 38 ) );
+		ntsc_pair_t p1 = NTSC_SUM6( NTSC_LOAD( n0 + 2 ), NTSC_LOAD( k0 +  9 ),
+				NTSC_LOAD( n1 + 14 ), NTSC_LOAD( k1 + 21 ), NTSC_LOAD( k2 + 33 ), NTSC_LOAD( x2 + 40 ) );
+		ntsc_pair_t p2 = NTSC_SUM6( NTSC_LOAD( n0 + 4 ), NTSC_LOAD( k0 + 11 ),
+				NTSC_LOAD( n1 + 16 ), NTSC_LOAD( k1 + 23 ), NTSC_LOAD( n2 + 28 ), NTSC_LOAD( k2 + 35 ) );
+		ntsc_pair_t p3 = NTSC_SUM6( NTSC_LOAD( n0 + 6 ), NTSC_LOAD( k0 + 13 ),
+				NTSC_LOAD( n1 + 18 ), NTSC_LOAD( k1 + 25 ), NTSC_LOAD( n2 + 30 ), NTSC_LOAD( k2 + 37 ) );
+		ntsc_quad_t lo = NTSC_NARROW( p0, p1 );
+		ntsc_quad_t hi = NTSC_NARROW( p2, p3 );
+		NTSC_CLAMP_OUT( lo, 1 );
+		NTSC_CLAMP_OUT( hi, 1 );
+		ntsc_store( out, lo, hi );
+	}
+
+	/* Same for SNES_NTSC_HIRES_OUT. Where a pair straddles a new input pixel
+	its two entries come from different kernels. */
+	static void ntsc_chunk_hires( snes_ntsc_out_t* out,
+			snes_ntsc_rgb_t const* const* n, snes_ntsc_rgb_t const* const* k, snes_ntsc_rgb_t const* const* x )
+	{
+		ntsc_pair_t p0 = NTSC_SUM2( NTSC_SUM6(
+				NTSC_LOAD( n[0] + 0 ), NTSC_LOAD( k[0] + 7 ),
+				NTSC_LOAD_SPLIT( k[1] + 6, n[1] + 0 ), NTSC_LOAD_SPLIT( x[1] + 13, k[1] + 7 ),
+				NTSC_LOAD( k[2] + 19 ), NTSC_LOAD( x[2] + 26 ) ), NTSC_SUM6(
+				NTSC_LOAD( k[3] + 18 ), NTSC_LOAD( x[3] + 25 ),
+				NTSC_LOAD( k[4] + 31 ), NTSC_LOAD( x[4] + 38 ),
+				NTSC_LOAD( k[5] + 30 ), NTSC_LOAD( x[5] + 37 ) ) );
+		ntsc_pair_t p1 = NTSC_SUM2( NTSC_SUM6(
+				NTSC_LOAD( n[0] + 2 ), NTSC_LOAD( k[0] + 9 ),
+				NTSC_LOAD( n[1] + 1 ), NTSC_LOAD( k[1] + 8 ),
+				NTSC_LOAD( n[2] + 14 ), NTSC_LOAD( k[2] + 21 ) ), NTSC_SUM6(
+				NTSC_LOAD_SPLIT( k[3] + 20, n[3] + 14 ), NTSC_LOAD_SPLIT( x[3] + 27, k[3] + 21 ),
+				NTSC_LOAD( k[4] + 33 ), NTSC_LOAD( x[4] + 40 ),
+				NTSC_LOAD( k[5] + 32 ), NTSC_LOAD( x[5] + 39 ) ) );
+		ntsc_pair_t p2 = NTSC_SUM2( NTSC_SUM6(
+				NTSC_LOAD( n[0] + 4 ), NTSC_LOAD( k[0] + 11 ),
+				NTSC_LOAD( n[1] + 3 ), NTSC_LOAD( k[1] + 10 ),
+				NTSC_LOAD( n[2] + 16 ), NTSC_LOAD( k[2] + 23 ) ), NTSC_SUM6(
+				NTSC_LOAD( n[3] + 15 ), NTSC_LOAD( k[3] + 22 ),
+				NTSC_LOAD( n[4] + 28 ), NTSC_LOAD( k[4] + 35 ),
+				NTSC_LOAD_SPLIT( k[5] + 34, n[5] + 28 ), NTSC_LOAD_SPLIT( x[5] + 41, k[5] + 35 ) ) );
+		ntsc_pair_t p3 = NTSC_SUM2( NTSC_SUM6(
+				NTSC_LOAD( n[0] + 6 ), NTSC_LOAD( k[0] + 13 ),
+				NTSC_LOAD( n[1] + 5 ), NTSC_LOAD( k[1] + 12 ),
+				NTSC_LOAD( n[2] + 18 ), NTSC_LOAD( k[2] + 25 ) ), NTSC_SUM6(
+				NTSC_LOAD( n[3] + 17 ), NTSC_LOAD( k[3] + 24 ),
+				NTSC_LOAD( n[4] + 30 ), NTSC_LOAD( k[4] + 37 ),
+				NTSC_LOAD( n[5] + 29 ), NTSC_LOAD( k[5] + 36 ) ) );
+		ntsc_quad_t lo = NTSC_NARROW( p0, p1 );
+		ntsc_quad_t hi = NTSC_NARROW( p2, p3 );
+		NTSC_CLAMP_OUT( lo, 0 );
+		NTSC_CLAMP_OUT( hi, 0 );
+		ntsc_store( out, lo, hi );
+	}
+#endif
+
 void snes_ntsc_blit( snes_ntsc_t const* ntsc, SNES_NTSC_IN_T const* input, long in_row_width,
 		int burst_phase, int in_width, int in_height, void* rgb_out, long out_pitch )
 {
@@ -147,6 +291,18 @@ void snes_ntsc_blit( snes_ntsc_t const* ntsc, SNES_NTSC_IN_T const* input, long
 		
 		for ( n = chunk_count; n; --n )
 		{
+		#if SNES_NTSC_SIMD
+			unsigned const color0 = SNES_NTSC_ADJ_IN( line_in [0] );
+			unsigned const color1 = SNES_NTSC_ADJ_IN( line_in [1] );
+			unsigned const color2 = SNES_NTSC_ADJ_IN( line_in [2] );
+			snes_ntsc_rgb_t const* next0 = SNES_NTSC_IN_FORMAT( ktable, color0 );
+			snes_ntsc_rgb_t const* next1 = SNES_NTSC_IN_FORMAT( ktable, color1 );
+			snes_ntsc_rgb_t const* next2 = SNES_NTSC_IN_FORMAT( ktable, color2 );
+			ntsc_chunk( line_out, next0, kernel0, next1, kernel1, kernelx1, next2, kernel2, kernelx2 );
+			kernelx0 = kernel0; kernel0 = next0;
+			kernelx1 = kernel1; kernel1 = next1;
+			kernelx2 = kernel2; kernel2 = next2;
+		#else
 			/* order of input and output pixels must not be altered */
 			SNES_NTSC_COLOR_IN( 0, SNES_NTSC_ADJ_IN( line_in [0] ) );
 			SNES_NTSC_RGB_OUT( 0, line_out [0], SNES_NTSC_OUT_DEPTH );
@@ -160,6 +316,7 @@ void snes_ntsc_blit( snes_ntsc_t const* ntsc, SNES_NTSC_IN_T const* input, long
 			SNES_NTSC_RGB_OUT( 4, line_out [4], SNES_NTSC_OUT_DEPTH );
 			SNES_NTSC_RGB_OUT( 5, line_out [5], SNES_NTSC_OUT_DEPTH );
 			SNES_NTSC_RGB_OUT( 6, line_out [6], SNES_NTSC_OUT_DEPTH );
+		#endif
 			
 			line_in  += 3;
 			line_out += 7;
@@ -202,6 +359,28 @@ void snes_ntsc_blit_hires( snes_ntsc_t const* ntsc, SNES_NTSC_IN_T const* input,
 		
 		for ( n = chunk_count; n; --n )
 		{
+		#if SNES_NTSC_SIMD
+			snes_ntsc_rgb_t const* next [6];
+			snes_ntsc_rgb_t const* prev [6];
+			snes_ntsc_rgb_t const* prevx [6];
+			int i;
+			for ( i = 0; i < 6; i++ )
+			{
+				unsigned const color = SNES_NTSC_ADJ_IN( line_in [i] );
+				next [i] = SNES_NTSC_IN_FORMAT( ktable, color );
+			}
+			prev [0] = kernel0; prev [1] = kernel1; prev [2] = kernel2;
+			prev [3] = kernel3; prev [4] = kernel4; prev [5] = kernel5;
+			prevx [0] = kernel0; prevx [1] = kernelx1; prevx [2] = kernelx2;
+			prevx [3] = kernelx3; prevx [4] = kernelx4; prevx [5] = kernelx5;
+			ntsc_chunk_hires( line_out, next, prev, prevx );
+			kernelx0 = kernel0; kernel0 = next [0];
+			kernelx1 = kernel1; kernel1 = next [1];
+			kernelx2 = kernel2; kernel2 = next [2];
+			kernelx3 = kernel3; kernel3 = next [3];
+			kernelx4 = kernel4; kernel4 = next [4];
+			kernelx5 = kernel5; kernel5 = next [5];
+		#else
 			/* twice as many input pixels per chunk */
 			SNES_NTSC_COLOR_IN( 0, SNES_NTSC_ADJ_IN( line_in [0] ) );
 			SNES_NTSC_HIRES_OUT( 0, line_out [0], SNES_NTSC_OUT_DEPTH );
@@ -221,6 +400,7 @@ void snes_ntsc_blit_hires( snes_ntsc_t const* ntsc, SNES_NTSC_IN_T const* input,
 			SNES_NTSC_COLOR_IN( 5, SNES_NTSC_ADJ_IN( line_in [5] ) );
 			SNES_NTSC_HIRES_OUT( 5, line_out [5], SNES_NTSC_OUT_DEPTH );
 			SNES_NTSC_HIRES_OUT( 6, line_out [6], SNES_NTSC_OUT_DEPTH );
+		#endif
 			
 			line_in  += 6;
 			line_out += 7;
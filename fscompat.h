@@ -24,6 +24,7 @@ enum s9x_getdirtype
 	BIOS_DIR,
 	LOG_DIR,
 	SAT_DIR,
+	CACHE_DIR,
 	LAST_DIR
 };
 
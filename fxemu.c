@@ -158,7 +158,7 @@
 #define FALSE 0
 #endif
 
-uint8_t  *SFXFillRAM           = 0;
+S9X_TLS uint8_t  *SFXFillRAM           = 0;
 /* Per-line GSU budget, in "0.417-duty Hz".  This must match what snes9x2010
    ships as its default (625500 cycles/s per MHz at the default "10 MHz"
    setting = 6255000): the executor below is snes9x2010's, and its per-opcode
@@ -167,8 +167,8 @@ uint8_t  *SFXFillRAM           = 0;
    which starves plot/memory-bound titles (Yoshi's Island renders its whole
    sprite plane and collision state on the GSU against a fixed VBlank DMA
    schedule and is the first casualty; see libretro/snes9x#314). */
-uint32_t  SuperFXSpeedPerLineHz = 6255000;
-uint8_t   SuperFXPalFlag        = 0;
+S9X_TLS uint32_t  SuperFXSpeedPerLineHz = 6255000;
+S9X_TLS uint8_t   SuperFXPalFlag        = 0;
 
 #ifndef SNES_CYCLES_PER_SCANLINE
 #define SNES_CYCLES_PER_SCANLINE 1364
@@ -4589,7 +4589,7 @@ void S9xResetSuperFX (void)
  * regardless of GSU state, but this port only calls the exec with GO set -
  * and the publish happens precisely when the GSU stops, so a hold counted
  * there would freeze the moment it mattered. */
-int fx_cel_delay = 0;	/* lines to hold the publish; set by ApplyROMFixes */
+S9X_TLS int fx_cel_delay = 0;	/* lines to hold the publish; set by ApplyROMFixes */
 
 void S9xSuperFXCelDelayTick (void)
 {
@@ -4732,10 +4732,8 @@ static void fx_writeRegisterSpace (void)
 #define FX_CYC_AVG_NUM	12	/* budget scale numerator   (12/5 == 2.4 ~= 1/0.417) */
 #define FX_CYC_AVG_DEN	5	/* budget scale denominator */
 
-int		fx_cycle_accuracy = 1;	/* set from the core option (default on) */
-static uint8_t	fx_OpcodeCycles[1024];	/* indexed by (vStatusReg & 0x300) | opcode, i.e. 0..0x3ff */
-static uint32_t	fx_multWait;
-static int	fx_cycleTableReady = 0;
+S9X_TLS int		fx_cycle_accuracy = 1;	/* set from the core option (default on) */
+static S9X_TLS uint32_t	fx_multWait;
 
 /* --- Hardware-derived GSU timing (backported from snes9xgit mainline) ---------
  * When fx_hw_timing is 1 the per-line budget is a flat 1364 master-cycle slice
@@ -4755,85 +4753,96 @@ static int	fx_cycleTableReady = 0;
  * express.  The fetch charge is cache-aware and paid per pipe byte, so
  * multi-byte instructions (ibt/iwt/lm/sm/lms/sms, branches) pay for their
  * operand fetches exactly as upstream does. */
-int		fx_hw_timing = 0;		/* 0 = compat (snes9x2010 budget), 1 = hardware costs */
-uint32_t	SuperFXHwTimingPct = 100;	/* overclock percentage applied to the flat budget */
-static uint8_t	fx_HwLen[1024];			/* pipe bytes per opcode (fetch cost multiplier) */
-static uint8_t	fx_HwExec[2][1024];		/* static memory-access cost per opcode, [CLSR] */
-static int	fx_hwTablesReady = 0;
-
-static void fx_initHwTables (void)
-{
-	int alt, op, cs;
-
-	for (op = 0; op < 1024; op++)
-	{
-		fx_HwLen[op]     = 1;
-		fx_HwExec[0][op] = 0;
-		fx_HwExec[1][op] = 0;
-	}
-
-	for (cs = 0; cs < 2; cs++)
-	{
-		uint8_t mem = cs ? 5 : 6;
-
-		for (alt = 0; alt < 4; alt++)
-		{
-			int b = alt << 8;
-
-			for (op = 0x30; op <= 0x3b; op++)	/* stw (even alt) / stb (odd alt) */
-				fx_HwExec[cs][b | op] = (alt & 1) ? mem : (uint8_t) (mem << 1);
-			for (op = 0x40; op <= 0x4b; op++)	/* ldw (even alt) / ldb (odd alt) */
-				fx_HwExec[cs][b | op] = (alt & 1) ? mem : (uint8_t) (mem << 1);
-
-			fx_HwExec[cs][b | 0x90] = (uint8_t) (mem << 1);	/* sbk */
-			fx_HwExec[cs][b | 0xef] = mem;			/* getb/getbh/getbl/getbs */
+S9X_TLS int		fx_hw_timing = 0;		/* 0 = compat (snes9x2010 budget), 1 = hardware costs */
+S9X_TLS uint32_t	SuperFXHwTimingPct = 100;	/* overclock percentage applied to the flat budget */
+
+/* The cost tables below are fixed, so they are written out rather than built
+ * at run time, and every console in the process reads the same copy.  Each
+ * is indexed by (vStatusReg & 0x300) | opcode: four 256-entry ALT banks,
+ * each laid out a row of 16 opcodes at a time. */
+#define FX_R2(x)	x, x
+#define FX_R4(x)	FX_R2(x), FX_R2(x)
+#define FX_R8(x)	FX_R4(x), FX_R4(x)
+#define FX_R16(x)	FX_R8(x), FX_R8(x)
+
+/* Per-opcode cycle budget.  sbk and getc are ALT0 only; lms/sms and lm/sm
+ * are ALT1 and ALT2 (the same opcodes are ibt/iwt in ALT0 and ALT3). */
+#define FX_CYC_BANK(sbk, getc, lm) \
+	FX_R16(FX_CYC_BASE),									/* 0x00 */ \
+	FX_R16(FX_CYC_BASE),									/* 0x10 */ \
+	FX_R16(FX_CYC_BASE),									/* 0x20 */ \
+	FX_R8(FX_CYC_MEM), FX_R4(FX_CYC_MEM), FX_R4(FX_CYC_BASE),	/* 0x30 stw/stb */ \
+	FX_R8(FX_CYC_MEM), FX_R4(FX_CYC_MEM), FX_CYC_PLOT,		/* 0x40 ldw/ldb, plot/rpix */ \
+		FX_R2(FX_CYC_BASE), FX_CYC_BASE, \
+	FX_R16(FX_CYC_BASE),									/* 0x50 */ \
+	FX_R16(FX_CYC_BASE),									/* 0x60 */ \
+	FX_R16(FX_CYC_BASE),									/* 0x70 */ \
+	FX_R16(FX_CYC_MULT),									/* 0x80 mult/umult */ \
+	sbk, FX_R8(FX_CYC_BASE), FX_R4(FX_CYC_BASE),			/* 0x90 sbk, fmult/lmult */ \
+		FX_R2(FX_CYC_BASE), FX_CYC_FMULT, \
+	FX_R16(lm),												/* 0xa0 lms/sms */ \
+	FX_R16(FX_CYC_BASE),									/* 0xb0 */ \
+	FX_R16(FX_CYC_BASE),									/* 0xc0 */ \
+	FX_R8(FX_CYC_BASE), FX_R4(FX_CYC_BASE), FX_R2(FX_CYC_BASE),	/* 0xd0 getc */ \
+		FX_CYC_BASE, getc, \
+	FX_R8(FX_CYC_BASE), FX_R4(FX_CYC_BASE), FX_R2(FX_CYC_BASE),	/* 0xe0 getb* */ \
+		FX_CYC_BASE, FX_CYC_MEM, \
+	FX_R16(lm)												/* 0xf0 lm/sm */
+
+static const uint8_t	fx_OpcodeCycles[1024] =
+{
+	FX_CYC_BANK(FX_CYC_MEM,  FX_CYC_MEM,  FX_CYC_BASE),
+	FX_CYC_BANK(FX_CYC_BASE, FX_CYC_BASE, FX_CYC_MEM),
+	FX_CYC_BANK(FX_CYC_BASE, FX_CYC_BASE, FX_CYC_MEM),
+	FX_CYC_BANK(FX_CYC_BASE, FX_CYC_BASE, FX_CYC_BASE)
+};
 
-			if (alt != 0)
-			{
-				for (op = 0xa0; op <= 0xaf; op++)	/* lms/sms */
-					fx_HwExec[cs][b | op] = (uint8_t) (mem << 1);
-				for (op = 0xf0; op <= 0xff; op++)	/* lm/sm */
-					fx_HwExec[cs][b | op] = (uint8_t) (mem << 1);
-			}
-		}
-	}
+/* Pipe bytes per instruction: fetch cost applies to operand bytes too.
+ * Branches take an offset byte, ibt/lms/sms one operand byte and
+ * iwt/lm/sm two. */
+#define FX_HWLEN_BANK \
+	FX_R4(1), 1, FX_R8(2), FX_R2(2), 2,	/* 0x00 branches */ \
+	FX_R16(1), FX_R16(1), FX_R16(1),	/* 0x10-0x3f */ \
+	FX_R16(1), FX_R16(1), FX_R16(1),	/* 0x40-0x6f */ \
+	FX_R16(1), FX_R16(1), FX_R16(1),	/* 0x70-0x9f */ \
+	FX_R16(2),							/* 0xa0 ibt/lms/sms */ \
+	FX_R16(1), FX_R16(1), FX_R16(1),	/* 0xb0-0xdf */ \
+	FX_R16(1),							/* 0xe0 */ \
+	FX_R16(3)							/* 0xf0 iwt/lm/sm */
+
+static const uint8_t	fx_HwLen[1024] =
+{
+	FX_HWLEN_BANK, FX_HWLEN_BANK, FX_HWLEN_BANK, FX_HWLEN_BANK
+};
 
-	/* Pipe bytes per instruction: fetch cost applies to operand bytes too. */
-	for (alt = 0; alt < 4; alt++)
-	{
-		int b = alt << 8;
-
-		for (op = 0x05; op <= 0x0f; op++)	/* branches: opcode + offset */
-			fx_HwLen[b | op] = 2;
-		for (op = 0xa0; op <= 0xaf; op++)	/* ibt/lms/sms: opcode + 1 */
-			fx_HwLen[b | op] = 2;
-		for (op = 0xf0; op <= 0xff; op++)	/* iwt/lm/sm: opcode + 2 */
-			fx_HwLen[b | op] = 3;
+/* Static memory-access cost per opcode, [CLSR]: mem is a byte access (5 at
+ * 21 MHz, 6 at 10.7 MHz) and word accesses charge two.  The 0x30/0x40 rows
+ * are stw/ldw (word) in even banks and stb/ldb (byte) in odd ones; lms/sms
+ * and lm/sm exist outside ALT0. */
+#define FX_HWEXEC_BANK(mem, ldst, lm) \
+	FX_R16(0), FX_R16(0), FX_R16(0),						/* 0x00-0x2f */ \
+	FX_R8(ldst), FX_R4(ldst), FX_R4(0),						/* 0x30 stw/stb */ \
+	FX_R8(ldst), FX_R4(ldst), FX_R4(0),						/* 0x40 ldw/ldb */ \
+	FX_R16(0), FX_R16(0), FX_R16(0), FX_R16(0),				/* 0x50-0x8f */ \
+	(mem) << 1, FX_R8(0), FX_R4(0), FX_R2(0), 0,			/* 0x90 sbk */ \
+	FX_R16(lm),												/* 0xa0 lms/sms */ \
+	FX_R16(0), FX_R16(0), FX_R16(0),						/* 0xb0-0xdf */ \
+	FX_R8(0), FX_R4(0), FX_R2(0), 0, mem,					/* 0xe0 getb* */ \
+	FX_R16(lm)												/* 0xf0 lm/sm */
+
+#define FX_HWEXEC_CLSR(mem) \
+	{ \
+		FX_HWEXEC_BANK(mem, (mem) << 1, 0), \
+		FX_HWEXEC_BANK(mem, mem,        (mem) << 1), \
+		FX_HWEXEC_BANK(mem, (mem) << 1, (mem) << 1), \
+		FX_HWEXEC_BANK(mem, mem,        (mem) << 1) \
 	}
 
-	fx_hwTablesReady = 1;
-}
-
-static void fx_initCycleTable (void)
+static const uint8_t	fx_HwExec[2][1024] =
 {
-	int alt, op;
-	for (op = 0; op < 1024; op++) fx_OpcodeCycles[op] = FX_CYC_BASE;
-	for (alt = 0; alt < 4; alt++)
-	{
-		int b = alt << 8;
-		for (op = 0x30; op <= 0x3b; op++) fx_OpcodeCycles[b | op] = FX_CYC_MEM;	/* stw/stb  */
-		for (op = 0x40; op <= 0x4b; op++) fx_OpcodeCycles[b | op] = FX_CYC_MEM;	/* ldw/ldb  */
-		fx_OpcodeCycles[b | 0x4c] = FX_CYC_PLOT;				/* plot/rpix*/
-		for (op = 0x80; op <= 0x8f; op++) fx_OpcodeCycles[b | op] = FX_CYC_MULT;	/* mult/umult */
-		fx_OpcodeCycles[b | 0x9f] = FX_CYC_FMULT;				/* fmult/lmult */
-		fx_OpcodeCycles[b | 0xef] = FX_CYC_MEM;					/* getb*    */
-	}
-	fx_OpcodeCycles[0x90] = FX_CYC_MEM;	/* sbk  */
-	fx_OpcodeCycles[0xdf] = FX_CYC_MEM;	/* getc */
-	for (op = 0xa0; op <= 0xaf; op++) { fx_OpcodeCycles[(1<<8)|op] = FX_CYC_MEM; fx_OpcodeCycles[(2<<8)|op] = FX_CYC_MEM; } /* lms/sms */
-	for (op = 0xf0; op <= 0xff; op++) { fx_OpcodeCycles[(1<<8)|op] = FX_CYC_MEM; fx_OpcodeCycles[(2<<8)|op] = FX_CYC_MEM; } /* lm/sm   */
-	fx_cycleTableReady = 1;
-}
+	FX_HWEXEC_CLSR(6),
+	FX_HWEXEC_CLSR(5)
+};
 
 void S9xSuperFXExec (void)
 {
@@ -4846,8 +4855,6 @@ void S9xSuperFXExec (void)
 	/* Read registers and initialize GSU session*/
 	fx_readRegisterSpace();
 
-	if (fx_cycle_accuracy && !fx_cycleTableReady) fx_initCycleTable();
-	if (fx_hw_timing && !fx_hwTablesReady) fx_initHwTables();
 	fx_multWait = (GSU.pvRegisters[GSU_CFGR] & 0x20) ? 0 : 1;
    
 	/* Check if we start inside the cache*/
@@ -4865,7 +4872,7 @@ void S9xSuperFXExec (void)
 		/* GSU executions functions*/
 		if (fx_hw_timing)
 		{
-			/* Hardware-derived costs (see fx_initHwTables above): flat
+			/* Hardware-derived costs (see fx_HwExec above): flat
 			   1364 master-cycle line budget, CLSR carried by the costs,
 			   cache-aware fetch charged per pipe byte. */
 			uint32_t cs        = (SFXFillRAM[0x3000 + GSU_CLSR] & 1);
@@ -4946,7 +4953,7 @@ void S9xSuperFXExec (void)
 		}
 		else
 		{
-			/* Per-opcode cycle budget (see fx_initCycleTable above). */
+			/* Per-opcode cycle budget (see fx_OpcodeCycles above). */
 			GSU.vCounter = (uint32_t)((uint64_t)nInstructions * FX_CYC_AVG_NUM / FX_CYC_AVG_DEN);
 			while (TF(G) && GSU.vCounter > 0)
 			{
@@ -176,22 +176,22 @@ struct FxInfo_s
  * single grant bit. Ported from mainline snes9x (af4ec50b). */
 #define CHECK_EXEC_SUPERFX() ((SFXFillRAM[0x3000 + GSU_SFR] & FLG_G) && (SFXFillRAM[0x3000 + GSU_SCMR] & 0x18) != 0)
 
-extern struct FxInfo_s	SuperFX;
+extern S9X_TLS struct FxInfo_s	SuperFX;
 
 void S9xResetSuperFX (void);
 void S9xSuperFXCelDelayTick (void);
-extern int fx_cel_delay;
+extern S9X_TLS int fx_cel_delay;
 void S9xSuperFXRecomputeSpeedPerLine (void);
 void S9xInitSuperFX (void);
 void S9xSetSuperFX (uint8_t byte, uint16_t address);
 uint8_t S9xGetSuperFX (uint16_t address);
 
 /* Bridges to the C++ side. */
-extern uint8_t  *SFXFillRAM;             /* = Memory.FillRAM */
-extern uint32_t  SuperFXSpeedPerLineHz;  /* GSU Hz x 0.417 duty; scaled by the overclock option */
-extern int       fx_hw_timing;           /* 0 = compat budget, 1 = hardware-derived GSU costs */
-extern uint32_t  SuperFXHwTimingPct;     /* overclock percentage for the hardware budget */
-extern uint8_t   SuperFXPalFlag;
+extern S9X_TLS uint8_t  *SFXFillRAM;             /* = Memory.FillRAM */
+extern S9X_TLS uint32_t  SuperFXSpeedPerLineHz;  /* GSU Hz x 0.417 duty; scaled by the overclock option */
+extern S9X_TLS int       fx_hw_timing;           /* 0 = compat budget, 1 = hardware-derived GSU costs */
+extern S9X_TLS uint32_t  SuperFXHwTimingPct;     /* overclock percentage for the hardware budget */
+extern S9X_TLS uint8_t   SuperFXPalFlag;
 void S9xSuperFXIRQHook (void);           /* CPU.IRQExternal = TRUE  (cpu.cpp) */
 void S9xSuperFXIRQClearHook (void);      /* CPU.IRQExternal = FALSE (cpu.cpp) */
 void S9xSuperFXExec (void);
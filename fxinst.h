@@ -403,7 +403,7 @@ struct FxRegs_s
 	uint8_t		vCelHeld;			/* The cel value being held back (0 = none). */
 };
 
-extern struct FxRegs_s	GSU;
+extern S9X_TLS struct FxRegs_s	GSU;
 
 #ifdef FX_DO_ROMBUFFER
 /* Read R14 */
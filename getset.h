@@ -17,6 +17,7 @@
 #include "seta.h"
 #include "bsx.h"
 #include "msu1.h"
+#include "dirty.h"
 
 #define addCyclesInMemoryAccess \
 	if (!CPU.InDMAorHDMA) \
@@ -34,7 +35,17 @@
 			S9xDoHEventProcessing(); \
 	}
 
-extern uint8	OpenBus;
+extern S9X_TLS uint8	OpenBus;
+
+// Direct-mapped writes land in WRAM, SRAM or a coprocessor's RAM. Only WRAM
+// is stamped here; see dirty.h for the rest.
+static inline void S9xDirtyMapped (const uint8 *p)
+{
+	size_t	offset = (size_t) (p - Memory.RAM);
+
+	if (offset < sizeof(SArena::RAM))
+		S9xDirtyRAM((uint32) offset);
+}
 
 static inline int32 memory_speed (uint32 address)
 {
@@ -346,6 +357,7 @@ inline void S9xSetByte (uint8 Byte, uint32 Address)
 	if (SetAddress >= (uint8 *) CMemory::MAP_LAST)
 	{
 		*(SetAddress + (Address & 0xffff)) = Byte;
+		S9xDirtyMapped(SetAddress + (Address & 0xffff));
 		addCyclesInMemoryAccess;
 		return;
 	}
@@ -491,6 +503,8 @@ inline void S9xSetWord (uint16 Word, uint32 Address, enum s9xwrap_t w = WRAP_NON
 	if (SetAddress >= (uint8 *) CMemory::MAP_LAST)
 	{
 		WRITE_WORD(SetAddress + (Address & 0xffff), Word);
+		S9xDirtyMapped(SetAddress + (Address & 0xffff));
+		S9xDirtyMapped(SetAddress + (Address & 0xffff) + 1);
 		addCyclesInMemoryAccess_x2;
 		return;
 	}
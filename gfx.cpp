@@ -15,23 +15,23 @@
 #include <string>
 
 /* Extracted from SGFX so the struct stays C-visible for tile.c. */
-static std::vector<uint16> GFXScreenBuffer;
-std::string GFXInfoString;
+static S9X_TLS_OBJECT std::vector<uint16> GFXScreenBuffer;
+S9X_TLS_OBJECT std::string GFXInfoString;
 
 /* tile.c-side bridges (C linkage): VRAM/FillRAM for the C tile renderer
    without pulling memmap.h into C. Set in S9xGraphicsInit. */
-extern "C" { uint8 *tile_VRAM; uint8 *tile_FillRAM;
-             uint8 TileMode7Hires = 0; uint8 TileMode7HiresBilinear = 0; }
+extern "C" { S9X_TLS uint8 *tile_VRAM; S9X_TLS uint8 *tile_FillRAM;
+             S9X_TLS uint8 TileMode7Hires = 0; S9X_TLS uint8 TileMode7HiresBilinear = 0; }
 
-extern struct SCheatData		Cheat;
-extern struct SLineData			LineData[240];
-extern struct SLineMatrixData	LineMatrixData[240];
+extern S9X_TLS_OBJECT struct SCheatData		Cheat;
+extern S9X_TLS struct SLineData			LineData[240];
+extern S9X_TLS struct SLineMatrixData	LineMatrixData[240];
 
 void S9xComputeClipWindows (void);
 
 void (*S9xCustomDisplayString) (const char *, int, int, bool, int) = NULL;
 
-static void SetupOBJ (void);
+static void SetupOBJ (bool8);
 static void DrawOBJS (int);
 static void DrawBackground (int, uint8, uint8);
 static void DrawBackgroundMosaic (int, uint8, uint8);
@@ -40,46 +40,134 @@ static void DrawBackgroundOffsetMosaic (int, uint8, uint8, int);
 static inline void DrawBackgroundMode7 (int, void (*DrawMath) (uint32, uint32, int), void (*DrawNomath) (uint32, uint32, int), int);
 static inline void DrawBackdrop (void);
 static inline void RenderScreen (bool8);
+static void RenderScreenLayered (bool8);
+static void FlushLayerLines (void);
+static void CheckLayerLines (void);
 static uint16 get_crosshair_color (uint8);
 
 #define TILE_PLUS(t, x)	(((t) & 0xfc00) | ((t + x) & 0x3ff))
 
+static S9X_TLS uint32	BGBandSerial = 0;	// see SBGBand
 
-bool8 S9xGraphicsInit (void)
+// What the last SetupOBJ evaluated, so $2104 writes to a few sprites
+// only cost the lines those sprites cover. CoverY/CoverN are the lines
+// each sprite occupied (N = 0 when off-screen horizontally); RTO is the
+// per-line range/time-over bits before they are OR'd down the frame.
+static S9X_TLS struct
 {
-	S9xInitTileRenderer();
-	memset(BlackColourMap, 0, 256 * sizeof(uint16));
+	bool8	Valid;			// OBJLines match PPU.OBJ (FALSE after a counting pass)
+	bool8	Normal;			// built in FirstSprite order, not FirstSprite+Y
+	int		StartLine;
+	int		Inc;
+	int		MaxTiles;
+	uint8	CoverY[128];
+	uint8	CoverN[128];
+	uint8	RTO[SNES_HEIGHT_EXTENDED];
+}	OBJEval;
+
+static inline bool8 OBJDirty (void)
+{
+	return ((IPPU.OBJDirty[0] | IPPU.OBJDirty[1] | IPPU.OBJDirty[2] | IPPU.OBJDirty[3]) != 0);
+}
 
-	IPPU.OBJChanged = TRUE;
-	Settings.BG_Forced = 0;
-	Settings.ForcedBackdrop = 0;
-	S9xFixColourBrightness();
-	S9xBuildDirectColourMaps();
+// Duplicate-frame detection (Settings.SkipDuplicateFrames). A frame drawn in
+// one pass at its end depends only on the PPU state at that point: the
+// registers kept here, the per-line scroll and Mode 7 latches, and VRAM,
+// CGRAM and OAM, whose writes set IPPU.ScreenDirty. If all of that matches
+// the last displayed frame, and that frame was drawn in one pass too, the
+// new one would come out identical and need not be drawn or presented.
+static S9X_TLS struct
+{
+	bool8	Valid;
+	int		Lines;
+	uint8	Regs[0x34];		// $2100-$2133, see GetFrameRegs
+	uint8	FixedColour[3];
+	uint8	FirstSprite;
+	struct SLineData		LineData[240];
+	struct SLineMatrixData	LineMatrixData[240];
+}	LastFrame;
+
+static S9X_TLS uint32	FramePasses = 0;	// S9xUpdateScreen calls this frame
+
+static void GetFrameRegs (uint8 *regs)
+{
+	memcpy(regs, Memory.FillRAM + 0x2100, 0x34);
+
+	// Data ports and write-twice registers: the last byte written says
+	// nothing. What they set is compared on its own instead.
+	memset(regs + 0x02, 0, 3);		// OAM address/data: FirstSprite, ScreenDirty
+	memset(regs + 0x0d, 0, 13);		// BG scroll: LineData. VRAM port: ScreenDirty
+	memset(regs + 0x1b, 0, 8);		// M7 matrix: LineMatrixData. CGRAM port: ScreenDirty
+	regs[0x32] = 0;					// COLDATA: FixedColour
+}
 
-	/* Buffers sized for the widest supported frame (Mode 7 hires 4x,
-	   1024 px), snes9x2010's model: Pitch is the max buffer width and
-	   RealPPL derives from it; narrower frames use the left part of each
-	   row, and RenderedScreenWidth controls what the frontend sees. */
-	GFX.Pitch      = sizeof(uint16) * MAX_SNES_WIDTH_4X;
-	GFX.RealPPL    = MAX_SNES_WIDTH_4X;
-	GFX.ScreenSize = MAX_SNES_WIDTH_4X * MAX_SNES_HEIGHT;
-	tile_VRAM      = Memory.VRAM;
-	tile_FillRAM   = Memory.FillRAM;
-	GFXScreenBuffer.resize(MAX_SNES_WIDTH_4X * (MAX_SNES_HEIGHT + 64));
-	GFX.Screen = &GFXScreenBuffer[GFX.RealPPL * 32];
-	GFX.ZERO = (uint16 *) malloc(sizeof(uint16) * 0x10000);
-	GFX.SubScreen  = (uint16 *) malloc(GFX.ScreenSize * sizeof(uint16));
-	GFX.ZBuffer    = (uint8 *)  malloc(GFX.ScreenSize);
-	GFX.SubZBuffer = (uint8 *)  malloc(GFX.ScreenSize);
-
-	if (!GFX.ZERO || !GFX.SubScreen || !GFX.ZBuffer || !GFX.SubZBuffer)
-	{
-		S9xGraphicsDeinit();
+static bool8 FrameUnchanged (void)
+{
+	uint8	regs[0x34];
+
+	if (!Settings.SkipDuplicateFrames || !LastFrame.Valid || IPPU.ScreenDirty || FramePasses ||
+		GFX.DoInterlace || IPPU.Interlace || IPPU.InterlaceOBJ || IPPU.CurrentLine != LastFrame.Lines)
 		return (FALSE);
+
+	GetFrameRegs(regs);
+
+	return (!memcmp(regs, LastFrame.Regs, sizeof(regs)) &&
+		PPU.FixedColourRed == LastFrame.FixedColour[0] &&
+		PPU.FixedColourGreen == LastFrame.FixedColour[1] &&
+		PPU.FixedColourBlue == LastFrame.FixedColour[2] &&
+		PPU.FirstSprite == LastFrame.FirstSprite &&
+		!memcmp(LineData, LastFrame.LineData, LastFrame.Lines * sizeof(struct SLineData)) &&
+		(PPU.BGMode != 7 || !memcmp(LineMatrixData, LastFrame.LineMatrixData, LastFrame.Lines * sizeof(struct SLineMatrixData))));
+}
+
+static void RememberFrame (bool8 OnePass)
+{
+	IPPU.ScreenDirty = FALSE;
+
+	LastFrame.Valid = Settings.SkipDuplicateFrames && OnePass && FramePasses == 1 &&
+		!GFX.DoInterlace && !IPPU.Interlace && !IPPU.InterlaceOBJ && IPPU.CurrentLine <= 240;
+	if (!LastFrame.Valid)
+		return;
+
+	LastFrame.Lines = IPPU.CurrentLine;
+	GetFrameRegs(LastFrame.Regs);
+	LastFrame.FixedColour[0] = PPU.FixedColourRed;
+	LastFrame.FixedColour[1] = PPU.FixedColourGreen;
+	LastFrame.FixedColour[2] = PPU.FixedColourBlue;
+	LastFrame.FirstSprite = PPU.FirstSprite;
+	memcpy(LastFrame.LineData, LineData, LastFrame.Lines * sizeof(struct SLineData));
+	memcpy(LastFrame.LineMatrixData, LineMatrixData, LastFrame.Lines * sizeof(struct SLineMatrixData));
+}
+
+// S9xUpdateScreen for a frame that is not drawn: only what the CPU ($213E
+// range/time-over) or a snapshot can see. Clip windows come from the cache.
+static void SkipScreenUpdate (void)
+{
+	if (IPPU.OBJChanged || IPPU.InterlaceOBJ || !OBJEval.Valid || OBJDirty())
+		SetupOBJ(TRUE);
+
+	PPU.RangeTimeOver |= GFX.OBJLines[GFX.EndY].RTOFlags;
+
+	GFX.StartY = IPPU.PreviousLine;
+	if ((GFX.EndY = IPPU.CurrentLine - 1) >= PPU.ScreenHeight)
+		GFX.EndY = PPU.ScreenHeight - 1;
+
+	if (!PPU.ForcedBlanking && PPU.RecomputeClipWindows)
+	{
+		S9xComputeClipWindows();
+		PPU.RecomputeClipWindows = FALSE;
 	}
 
-	// Lookup table for 1/2 color subtraction
-	memset(GFX.ZERO, 0, 0x10000 * sizeof(uint16));
+	IPPU.PreviousLine = IPPU.CurrentLine;
+}
+
+
+// Lookup table for 1/2 color subtraction. It depends only on the pixel
+// format, so every console in the process shares the one copy.
+static uint16	ZeroTable[0x10000];
+
+static const uint16 * BuildZeroTable (void)
+{
 	for (uint32 r = 0; r <= MAX_RED; r++)
 	{
 		uint32	r2 = r;
@@ -104,21 +192,193 @@ bool8 S9xGraphicsInit (void)
 				else
 					b2 = 0;
 
-				GFX.ZERO[BUILD_PIXEL2(r, g, b)] = BUILD_PIXEL2(r2, g2, b2);
-				GFX.ZERO[BUILD_PIXEL2(r, g, b) & ~ALPHA_BITS_MASK] = BUILD_PIXEL2(r2, g2, b2);
+				ZeroTable[BUILD_PIXEL2(r, g, b)] = BUILD_PIXEL2(r2, g2, b2);
+				ZeroTable[BUILD_PIXEL2(r, g, b) & ~ALPHA_BITS_MASK] = BUILD_PIXEL2(r2, g2, b2);
 			}
 		}
 	}
 
+	return (ZeroTable);
+}
+
+// The screen buffers are allocated when the first frame is drawn, so a
+// console that never draws one (headless, audio only) has none. They are as
+// wide as the widest frame the settings allow - 512 px, or 1024 with Mode 7
+// hires at 4x - and are reallocated, wider, at the start of the first frame
+// drawn after that changes. Pitch is the buffer width: narrower frames use
+// the left part of each row, and RenderedScreenWidth controls what the
+// frontend sees.
+//
+// Each row carries SCREEN_MARGIN spare pixels past the widest frame. A tile
+// scrolled partly off the left edge plots its hidden hires halves at
+// negative offsets, into the tail of the row above; the margin keeps them
+// out of sight, and keeps Offset % RealPPL from mistaking a pixel at x = -1
+// for the one at x = 255 (see DRAW_PIXEL_H2x1).
+#define SCREEN_MARGIN	32
+
+// A port can have a frame drawn straight into a buffer of its own, the
+// frontend's video memory say, by calling S9xSetScreenTarget from
+// S9xInitUpdate. Only a plain low-res, non-interlaced frame can be: hires
+// plots hidden half-pixels left of a row's start, and interlace weaves into
+// the rows of the field before. A frame that turns into either partway down
+// moves the lines drawn so far back into GFX.Screen's own buffer and goes on
+// there. GFX.Screen and RealPPL point at the target while it is set.
+static S9X_TLS struct
+{
+	uint16	*Screen;		// GFX.Screen's own buffer while a target is set, else NULL
+	uint32	RealPPL;
+	bool8	Stale;			// the last frame ended in a target: GFX.Screen never held it
+}	OwnScreen;
+
+// Queued by S9xDrawCrosshair for the frame being ended.
+static S9X_TLS struct SCrosshairs	Crosshairs;
+
+bool8 S9xSetScreenTarget (uint16 *screen, uint32 ppl)
+{
+	if (OwnScreen.Screen || !GFX.Screen || IPPU.DoubleWidthPixels || IPPU.DoubleHeightPixels || GFX.DoInterlace ||
+		ppl < SNES_WIDTH || ppl > GFX.RealPPL)
+		return (FALSE);
+
+	OwnScreen.Screen = GFX.Screen;
+	OwnScreen.RealPPL = GFX.RealPPL;
+	GFX.Screen = screen;
+	GFX.RealPPL = GFX.PPL = ppl;
+
 	return (TRUE);
 }
 
-void S9xGraphicsDeinit (void)
+// Points GFX.Screen back at its own buffer, moving the lines drawn so far
+// over first if Copy.
+static void LeaveScreenTarget (bool8 Copy)
+{
+	if (!OwnScreen.Screen)
+		return;
+
+	int32	Lines = IPPU.PreviousLine < IPPU.RenderedScreenHeight ? IPPU.PreviousLine : IPPU.RenderedScreenHeight;
+
+	if (Copy)
+	{
+		for (int32 y = 0; y < Lines; y++)
+			memcpy(OwnScreen.Screen + y * OwnScreen.RealPPL, GFX.Screen + y * GFX.RealPPL, IPPU.RenderedScreenWidth * sizeof(uint16));
+
+		// CheckScreen rows are laid out like GFX.Screen's.
+		if (GFX.CheckScreen)
+			for (int32 y = Lines - 1; y > 0; y--)
+				memmove(GFX.CheckScreen + y * OwnScreen.RealPPL, GFX.CheckScreen + y * GFX.RealPPL, IPPU.RenderedScreenWidth * sizeof(uint16));
+	}
+
+	GFX.Screen = OwnScreen.Screen;
+	GFX.RealPPL = GFX.PPL = OwnScreen.RealPPL;
+	OwnScreen.Screen = NULL;
+}
+
+void S9xReleaseScreenTarget (void)
+{
+	LeaveScreenTarget(TRUE);
+}
+
+static void FreeScreenBuffers (void)
 {
-	if (GFX.ZERO)       { free(GFX.ZERO);       GFX.ZERO       = NULL; }
+	LeaveScreenTarget(FALSE);
+	std::vector<uint16>().swap(GFXScreenBuffer);
+	GFX.Screen = NULL;
+	GFX.Pitch = GFX.RealPPL = GFX.ScreenSize = 0;
+
 	if (GFX.SubScreen)  { free(GFX.SubScreen);  GFX.SubScreen  = NULL; }
 	if (GFX.ZBuffer)    { free(GFX.ZBuffer);    GFX.ZBuffer    = NULL; }
 	if (GFX.SubZBuffer) { free(GFX.SubZBuffer); GFX.SubZBuffer = NULL; }
+	if (GFX.CheckScreen) { free(GFX.CheckScreen); GFX.CheckScreen = NULL; }
+}
+
+static void FreeLayerBuffers (void)
+{
+	if (GFX.LayerScreen)     { free(GFX.LayerScreen);     GFX.LayerScreen     = NULL; }
+	if (GFX.LayerSubScreen)  { free(GFX.LayerSubScreen);  GFX.LayerSubScreen  = NULL; }
+	if (GFX.LayerZBuffer)    { free(GFX.LayerZBuffer);    GFX.LayerZBuffer    = NULL; }
+	if (GFX.LayerSubZBuffer) { free(GFX.LayerSubZBuffer); GFX.LayerSubZBuffer = NULL; }
+	if (GFX.LayerFlags)      { free(GFX.LayerFlags);      GFX.LayerFlags      = NULL; }
+}
+
+static bool8 AllocScreenBuffers (void)
+{
+	uint32	width = ((Settings.Mode7Hires == 4) ? MAX_SNES_WIDTH_4X : MAX_SNES_WIDTH) + SCREEN_MARGIN;
+
+	if (!GFX.Screen || GFX.RealPPL < width)
+	{
+		FreeScreenBuffers();
+
+		GFX.Pitch      = sizeof(uint16) * width;
+		GFX.RealPPL    = width;
+		GFX.ScreenSize = width * MAX_SNES_HEIGHT;
+		// 32 rows of black on either side, for overscan to crop into
+		GFXScreenBuffer.assign(width * (MAX_SNES_HEIGHT + 64), 0);
+		GFX.Screen     = &GFXScreenBuffer[GFX.RealPPL * 32];
+		GFX.SubScreen  = (uint16 *) malloc(GFX.ScreenSize * sizeof(uint16));
+		GFX.ZBuffer    = (uint8 *)  malloc(GFX.ScreenSize);
+		GFX.SubZBuffer = (uint8 *)  malloc(GFX.ScreenSize);
+
+		// Frames remembered at the old pitch are no use at the new one.
+		IPPU.ScreenDirty = TRUE;
+
+		if (!GFX.SubScreen || !GFX.ZBuffer || !GFX.SubZBuffer)
+		{
+			FreeScreenBuffers();
+			return (FALSE);
+		}
+	}
+
+	if (Settings.LayeredRenderer && !GFX.LayerScreen)
+	{
+		GFX.LayerScreen     = (uint16 *) malloc(SNES_WIDTH * SNES_HEIGHT_EXTENDED * sizeof(uint16));
+		GFX.LayerSubScreen  = (uint16 *) malloc(SNES_WIDTH * SNES_HEIGHT_EXTENDED * sizeof(uint16));
+		GFX.LayerZBuffer    = (uint8 *)  malloc(SNES_WIDTH * SNES_HEIGHT_EXTENDED);
+		GFX.LayerSubZBuffer = (uint8 *)  malloc(SNES_WIDTH * SNES_HEIGHT_EXTENDED);
+		GFX.LayerFlags      = (uint8 *)  malloc(SNES_WIDTH * SNES_HEIGHT_EXTENDED * 2);
+
+		if (!GFX.LayerScreen || !GFX.LayerSubScreen || !GFX.LayerZBuffer || !GFX.LayerSubZBuffer || !GFX.LayerFlags)
+		{
+			FreeLayerBuffers();
+			return (FALSE);
+		}
+	}
+
+	if (Settings.LayeredRenderer == 2 && !GFX.CheckScreen)
+	{
+		GFX.CheckScreen = (uint16 *) calloc(GFX.ScreenSize, sizeof(uint16));
+		if (!GFX.CheckScreen)
+			return (FALSE);
+	}
+
+	return (TRUE);
+}
+
+bool8 S9xGraphicsInit (void)
+{
+	static const uint16	*HalfSubTable = BuildZeroTable();	// once per process, thread-safe
+
+	S9xInitTileRenderer();
+	memset(BlackColourMap, 0, 256 * sizeof(uint16));
+
+	IPPU.OBJChanged = TRUE;
+	Settings.BG_Forced = 0;
+	Settings.ForcedBackdrop = 0;
+	S9xFixColourBrightness();
+	S9xBuildDirectColourMaps();
+
+	tile_VRAM    = Memory.VRAM;
+	tile_FillRAM = Memory.FillRAM;
+	GFX.ZERO     = HalfSubTable;
+	GFX.Layered  = FALSE;
+	memset(GFX.LayerLines, 0, sizeof(GFX.LayerLines));
+
+	return (TRUE);
+}
+
+void S9xGraphicsDeinit (void)
+{
+	GFX.ZERO = NULL;
+	FreeScreenBuffers();
+	FreeLayerBuffers();
 }
 
 void S9xGraphicsScreenResize (void)
@@ -182,20 +442,30 @@ void S9xStartScreenRefresh (void)
 	{
 		if (!GFX.DoInterlace || !S9xInterlaceField())
 		{
-			if (!S9xInitUpdate())
+			if (!AllocScreenBuffers())
 			{
 				IPPU.RenderThisFrame = FALSE;
 				return;
 			}
 
+			// The port is told after the resize, so that it knows the
+			// frame's geometry when it picks where to draw it.
 			S9xGraphicsScreenResize();
 
+			if (!S9xInitUpdate())
+			{
+				IPPU.RenderThisFrame = FALSE;
+				return;
+			}
+
 			IPPU.RenderedFramesCount++;
 		}
 
 		PPU.MosaicStart = 0;
 		PPU.RecomputeClipWindows = TRUE;
 		IPPU.PreviousLine = IPPU.CurrentLine = 0;
+		FramePasses = 0;
+		OwnScreen.Stale = FALSE;
 
 		memset(GFX.ZBuffer, 0, GFX.ScreenSize);
 		memset(GFX.SubZBuffer, 0, GFX.ScreenSize);
@@ -216,14 +486,44 @@ void S9xStartScreenRefresh (void)
 
 void S9xEndScreenRefresh (void)
 {
+	Crosshairs.Count = 0;
+
+	// Switched on too late in the frame to draw any of it.
+	if (!GFX.Screen)
+		IPPU.RenderThisFrame = FALSE;
+
+	// Ended a second time with no start between, as when overscan comes on
+	// after line 225: the frame went to a target the first time, and there
+	// is nothing to present again but what the port already has.
+	if (IPPU.RenderThisFrame && (OwnScreen.Stale || FrameUnchanged()))
+	{
+		// Same picture as the last displayed frame: the port sees no
+		// S9xDeinitUpdate this time and repeats what it has.
+		SkipScreenUpdate();
+		S9xControlEOF();
+	}
+	else
 	if (IPPU.RenderThisFrame)
 	{
+		bool8	OnePass = (FramePasses == 0);
+
 		FLUSH_REDRAW();
 
-		/* Mode 7 vertical-2x post-pass: expand the frame to
-		   PPU.ScreenHeight*2 rows in place before it is handed to the
-		   frontend. No-op when M7VertStartY is -1. */
-		S9xMode7VertResample();
+		// Lines drawn by the two-phase renderer are composited only now,
+		// at the width the frame ended up with.
+		FlushLayerLines();
+		CheckLayerLines();
+
+		/* Mode 7 vertical-2x post-pass: the port expands the frame
+		   (S9xMode7VertResample) when M7VertStartY is set, so that it
+		   can do so off the emulation thread. An interlaced frame is
+		   already two fields tall - doubling it again would need four
+		   times the height the buffer holds - and interlace already
+		   gives the vertical resolution the pass exists to make up. */
+		if (GFX.PPL != GFX.RealPPL)
+			IPPU.M7VertStartY = -1;
+
+		RememberFrame(OnePass);
 
 		if (GFX.DoInterlace && S9xInterlaceField() == 0)
 		{
@@ -246,6 +546,11 @@ void S9xEndScreenRefresh (void)
 	else
 		S9xControlEOF();
 
+	// Presented, or not drawn at all: the target was the port's for this
+	// frame only.
+	OwnScreen.Stale = (OwnScreen.Screen != NULL);
+	LeaveScreenTarget(FALSE);
+
 	S9xUpdateCheatsInMemory ();
 
 #ifdef DEBUGGER
@@ -283,8 +588,42 @@ void S9xEndScreenRefresh (void)
 	}
 }
 
+// A port's main loop ends between instructions, so a long DMA can carry it
+// past the frame boundary, and RenderThisFrame can come on partway down a
+// frame that S9xStartScreenRefresh let go by undrawn. If nothing has been
+// drawn yet there are no buffers: make them and draw from this line on.
+static bool8 StartFrameAt (uint8 C)
+{
+	if (!AllocScreenBuffers())
+		return (FALSE);
+
+	S9xGraphicsScreenResize();
+
+	if (!S9xInitUpdate())
+		return (FALSE);
+
+	// The rows above C are never drawn and show the new buffer's black,
+	// which a target would not.
+	LeaveScreenTarget(FALSE);
+
+	IPPU.RenderedFramesCount++;
+
+	PPU.RecomputeClipWindows = TRUE;
+	IPPU.PreviousLine = IPPU.CurrentLine = C;
+	OwnScreen.Stale = FALSE;
+	FramePasses = 0;
+
+	memset(GFX.ZBuffer, 0, GFX.ScreenSize);
+	memset(GFX.SubZBuffer, 0, GFX.ScreenSize);
+
+	return (TRUE);
+}
+
 void RenderLine (uint8 C)
 {
+	if (IPPU.RenderThisFrame && !GFX.Screen && !StartFrameAt(C))
+		IPPU.RenderThisFrame = FALSE;
+
 	if (IPPU.RenderThisFrame)
 	{
 		LineData[C].BG[0].VOffset = PPU.BG[0].VOffset + 1;
@@ -318,8 +657,8 @@ void RenderLine (uint8 C)
 	{
 		// if we're not rendering this frame, we still need to update this
 		// XXX: Check ForceBlank? Or anything else?
-		if (IPPU.OBJChanged)
-			SetupOBJ();
+		if (IPPU.OBJChanged || OBJDirty())
+			SetupOBJ(FALSE);
 		PPU.RangeTimeOver |= GFX.OBJLines[C].RTOFlags;
 	}
 }
@@ -348,6 +687,13 @@ static inline void RenderScreen (bool8 sub)
 		D = (Memory.FillRAM[0x2130] & 2) << 4; // 'do math' depth flag
 	}
 
+	if (GFX.Layered)
+	{
+		GFX.S  = sub ? GFX.LayerSubScreen  : GFX.LayerScreen;
+		GFX.DB = sub ? GFX.LayerSubZBuffer : GFX.LayerZBuffer;
+		GFX.LF = GFX.LayerFlags + (sub ? SNES_WIDTH * SNES_HEIGHT_EXTENDED : 0);
+	}
+
 	if (BGActive & 0x10)
 	{
 		BG.TileAddress = PPU.OBJNameBase;
@@ -452,10 +798,125 @@ static inline void RenderScreen (bool8 sub)
 	DrawBackdrop();
 }
 
+static void RenderScreenLayered (bool8 sub)
+{
+	// Phase 1: draw the band at native width, whatever the frame width is.
+	bool8	DoubleWidth = IPPU.DoubleWidthPixels, QuadWidth = IPPU.QuadWidthPixels;
+	uint32	PPL = GFX.PPL;
+	uint32	Rows = (GFX.EndY - GFX.StartY + 1) * SNES_WIDTH;
+
+	IPPU.DoubleWidthPixels = IPPU.QuadWidthPixels = FALSE;
+	GFX.PPL = SNES_WIDTH;
+	GFX.Layered = TRUE;
+
+	// No sub screen drawn means SD == 0 everywhere: math uses the fixed colour.
+	memset(GFX.LayerZBuffer + GFX.StartY * SNES_WIDTH, 0, Rows);
+	memset(GFX.LayerSubZBuffer + GFX.StartY * SNES_WIDTH, 0, Rows);
+
+	if (sub)
+		RenderScreen(TRUE);
+
+	RenderScreen(FALSE);
+
+	GFX.Layered = FALSE;
+	GFX.PPL = PPL;
+	IPPU.DoubleWidthPixels = DoubleWidth;
+	IPPU.QuadWidthPixels = QuadWidth;
+
+	uint8	MathOp = S9xTileMathOp();
+
+	for (uint32 y = GFX.StartY; y <= GFX.EndY; y++)
+	{
+		GFX.LayerLines[y].Pending = TRUE;
+		GFX.LayerLines[y].MathOp = MathOp;
+		GFX.LayerLines[y].FixedColour = GFX.FixedColour;
+	}
+
+	// The brightness-capped ops read brightness_cap[], which follows
+	// INIDISP: composite those lines before the next write can change it.
+	if (MathOp >= 7)
+		FlushLayerLines();
+}
+
+// Settings.LayeredRenderer == 2: draw the band the direct way as well, into
+// GFX.CheckScreen, so that CheckLayerLines can compare the two.
+static void DrawCheckLines (bool8 sub)
+{
+	uint16	*Screen = GFX.Screen;
+
+	GFX.Screen = GFX.CheckScreen;
+
+	if (sub)
+		RenderScreen(TRUE);
+
+	RenderScreen(FALSE);
+
+	GFX.Screen = Screen;
+
+	for (uint32 y = GFX.StartY; y <= GFX.EndY; y++)
+		GFX.LayerLines[y].Check = TRUE;
+}
+
+static void CheckLayerLines (void)
+{
+	int		Lines = 0, First = -1;
+
+	for (uint32 y = 0; y < SNES_HEIGHT_EXTENDED; y++)
+	{
+		if (!GFX.LayerLines[y].Check)
+			continue;
+
+		GFX.LayerLines[y].Check = FALSE;
+
+		if (memcmp(GFX.Screen + y * GFX.PPL, GFX.CheckScreen + y * GFX.PPL, IPPU.RenderedScreenWidth * sizeof(uint16)))
+		{
+			if (First < 0)
+				First = y;
+			Lines++;
+		}
+	}
+
+	if (Lines)
+	{
+		char	msg[96];
+
+		snprintf(msg, sizeof(msg), "Two-phase renderer: frame %u, %d lines differ from the direct path, first %d",
+			IPPU.TotalEmulatedFrames, Lines, First);
+		S9xMessage(S9X_WARNING, S9X_PPU_TRACE, msg);
+	}
+}
+
+static void FlushLayerLines (void)
+{
+	uint32	PixWidth = IPPU.QuadWidthPixels ? 4 : (IPPU.DoubleWidthPixels ? 2 : 1);
+
+	for (uint32 y = 0; y < SNES_HEIGHT_EXTENDED; y++)
+	{
+		if (GFX.LayerLines[y].Pending)
+		{
+			S9xCompositeLayerLine(y, GFX.Screen + y * GFX.PPL, PixWidth);
+			GFX.LayerLines[y].Pending = FALSE;
+		}
+	}
+}
+
+// Repeats each of the first 256 pixels of a row factor times, in place.
+static void WidenLine (uint16 *row, int factor)
+{
+	uint16	*p = row + 255;
+	uint16	*q = row + 256 * factor - 1;
+
+	for (int x = 255; x >= 0; x--, p--)
+		for (int i = 0; i < factor; i++, q--)
+			*q = *p;
+}
+
 void S9xUpdateScreen (void)
 {
-	if (IPPU.OBJChanged || IPPU.InterlaceOBJ)
-		SetupOBJ();
+	FramePasses++;
+
+	if (IPPU.OBJChanged || IPPU.InterlaceOBJ || !OBJEval.Valid || OBJDirty())
+		SetupOBJ(TRUE);
 
 	// XXX: Check ForceBlank? Or anything else?
 	PPU.RangeTimeOver |= GFX.OBJLines[GFX.EndY].RTOFlags;
@@ -487,15 +948,18 @@ void S9xUpdateScreen (void)
 			// sees BGMode == 7.
 			int factor = (PPU.BGMode == 7 && Settings.Mode7Hires == 4) ? 4 : 2;
 
+			LeaveScreenTarget(TRUE);
+
 			// Have to back out of the regular speed hack
 			for (uint32 y = 0; y < GFX.StartY; y++)
 			{
-				uint16	*p = GFX.Screen + y * GFX.PPL + 255;
-				uint16	*q = GFX.Screen + y * GFX.PPL + 256 * factor - 1;
+				if (GFX.LayerLines[y].Check)
+					WidenLine(GFX.CheckScreen + y * GFX.PPL, factor);
+
+				if (GFX.LayerLines[y].Pending)
+					continue;	// composited at the new width later
 
-				for (int x = 255; x >= 0; x--, p--)
-					for (int i = 0; i < factor; i++, q--)
-						*q = *p;
+				WidenLine(GFX.Screen + y * GFX.PPL, factor);
 			}
 
 			IPPU.DoubleWidthPixels = TRUE;
@@ -511,6 +975,10 @@ void S9xUpdateScreen (void)
 
 		if (!IPPU.DoubleHeightPixels && IPPU.Interlace && (PPU.BGMode == 5 || PPU.BGMode == 6))
 		{
+			FlushLayerLines();
+			CheckLayerLines();	// before the rows move
+			LeaveScreenTarget(TRUE);
+
 			IPPU.DoubleHeightPixels = TRUE;
 			IPPU.RenderedScreenHeight = PPU.ScreenHeight << 1;
 			GFX.PPL = GFX.RealPPL << 1;
@@ -523,13 +991,32 @@ void S9xUpdateScreen (void)
 		if ((Memory.FillRAM[0x2130] & 0x30) != 0x30 && (Memory.FillRAM[0x2131] & 0x3f))
 			GFX.FixedColour = BUILD_PIXEL(IPPU.XB[PPU.FixedColourRed], IPPU.XB[PPU.FixedColourGreen], IPPU.XB[PPU.FixedColourBlue]);
 
-		if (PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.PseudoHires ||
-			((Memory.FillRAM[0x2130] & 0x30) != 0x30 && (Memory.FillRAM[0x2130] & 2) && (Memory.FillRAM[0x2131] & 0x3f) && (Memory.FillRAM[0x212d] & 0x1f)))
-			// If hires (Mode 5/6 or pseudo-hires) or math is to be done
-			// involving the subscreen, then we need to render the subscreen...
-			RenderScreen(TRUE);
+		// New band of lines: tilemap decodes from the previous call are stale.
+		BGBandSerial++;
+
+		// If hires (Mode 5/6 or pseudo-hires) or math is to be done
+		// involving the subscreen, then we need to render the subscreen...
+		bool8	sub = PPU.BGMode == 5 || PPU.BGMode == 6 || IPPU.PseudoHires ||
+			((Memory.FillRAM[0x2130] & 0x30) != 0x30 && (Memory.FillRAM[0x2130] & 2) && (Memory.FillRAM[0x2131] & 0x3f) && (Memory.FillRAM[0x212d] & 0x1f));
+
+		// The two-phase renderer covers the plain tiled modes. Hires,
+		// interlace, Mode 7 and mosaic keep drawing straight into GFX.Screen.
+		if (Settings.LayeredRenderer && PPU.BGMode <= 4 && !IPPU.PseudoHires &&
+			!IPPU.Interlace && !IPPU.DoubleHeightPixels && !GFX.DoInterlace &&
+			!(PPU.Mosaic > 1 && (PPU.BGMosaic[0] || PPU.BGMosaic[1] || PPU.BGMosaic[2] || PPU.BGMosaic[3])))
+		{
+			if (Settings.LayeredRenderer == 2 && GFX.CheckScreen)
+				DrawCheckLines(sub);
+
+			RenderScreenLayered(sub);
+		}
+		else
+		{
+			if (sub)
+				RenderScreen(TRUE);
 
-		RenderScreen(FALSE);
+			RenderScreen(FALSE);
+		}
 	}
 	else
 	{
@@ -547,7 +1034,33 @@ void S9xUpdateScreen (void)
 	IPPU.PreviousLine = IPPU.CurrentLine;
 }
 
-static void SetupOBJ (void)
+// Width/visible tiles for one sprite (normal case), returning how many
+// lines it covers.
+static inline uint8 OBJSpriteLines (uint8 S, int Width, int Height, int startline, int inc)
+{
+	GFX.OBJWidths[S] = Width;
+
+	int	HPos = PPU.OBJ[S].HPos;
+	if (HPos == -256)
+		HPos = 0;
+
+	if (HPos <= -Width || HPos > 256)
+		return (0);
+
+	if (HPos < 0)
+		GFX.OBJVisibleTiles[S] = (Width + HPos + 7) >> 3;
+	else if (HPos + Width > 255)
+		GFX.OBJVisibleTiles[S] = (256 - HPos + 7) >> 3;
+	else
+		GFX.OBJVisibleTiles[S] = Width >> 3;
+
+	return ((Height - startline + inc - 1) / inc);
+}
+
+// Lists == FALSE is the counting-only pass for frames that are not
+// rendered: it produces the range/time-over flags but leaves the
+// per-line sprite lists stale, so the next rendered update rebuilds.
+static void SetupOBJ (bool8 Lists)
 {
 	int	SmallWidth, SmallHeight, LargeWidth, LargeHeight;
 
@@ -610,14 +1123,73 @@ static void SetupOBJ (void)
 	if (!PPU.OAMPriorityRotation || !(PPU.OAMFlip & PPU.OAMAddr & 1)) // normal case
 	{
 		uint8	LineOBJ[SNES_HEIGHT_EXTENDED];
+		bool8	LineDirty[SNES_HEIGHT_EXTENDED];
+		int		DirtyMin = SNES_HEIGHT_EXTENDED, DirtyMax = -1;
+
+		bool8	incremental = !IPPU.OBJChanged && OBJEval.Valid && OBJEval.Normal &&
+			OBJEval.StartLine == startline && OBJEval.Inc == inc && OBJEval.MaxTiles == Settings.MaxSpriteTilesPerLine;
+
+		if (incremental)
+		{
+			// Patching valid lists is cheaper than counting from scratch,
+			// so a skipped frame takes this path too.
+			Lists = TRUE;
+
+			// Only the lines under a changed sprite's old and new position
+			// are redone; every other line's list is still exact.
+			if (!OBJDirty())
+				return;
+
+			memset(LineDirty, FALSE, sizeof(LineDirty));
+
+			for (S = 0; S < 128; S++)
+			{
+				if (!(IPPU.OBJDirty[S >> 5] & (1u << (S & 31))))
+					continue;
+
+				for (int pass = 0; pass < 2; pass++)
+				{
+					if (pass)
+					{
+						Height = PPU.OBJ[S].Size ? LargeHeight : SmallHeight;
+						OBJEval.CoverY[S] = (uint8) (PPU.OBJ[S].VPos & 0xff);
+						OBJEval.CoverN[S] = OBJSpriteLines(S, PPU.OBJ[S].Size ? LargeWidth : SmallWidth, Height, startline, inc);
+					}
+
+					for (int k = 0; k < OBJEval.CoverN[S]; k++)
+					{
+						uint8	Y = (uint8) (OBJEval.CoverY[S] + k);
+						if (Y >= SNES_HEIGHT_EXTENDED)
+							continue;
+
+						LineDirty[Y] = TRUE;
+						if (Y < DirtyMin)
+							DirtyMin = Y;
+						if (Y > DirtyMax)
+							DirtyMax = Y;
+					}
+				}
+			}
+		}
+		else
+		{
+			memset(LineDirty, TRUE, sizeof(LineDirty));
+			DirtyMin = 0;
+			DirtyMax = SNES_HEIGHT_EXTENDED - 1;
+		}
+
 		memset(LineOBJ, 0, sizeof(LineOBJ));
 
-		for (int i = 0; i < SNES_HEIGHT_EXTENDED; i++)
+		for (int i = DirtyMin; i <= DirtyMax; i++)
 		{
-			GFX.OBJLines[i].RTOFlags = 0;
+			if (!LineDirty[i])
+				continue;
+
+			OBJEval.RTO[i] = 0;
 			GFX.OBJLines[i].Tiles = Settings.MaxSpriteTilesPerLine;
-			for (int j = 0; j < sprite_limit; j++)
-				GFX.OBJLines[i].OBJ[j].Sprite = -1;
+			if (Lists)
+				for (int j = 0; j < sprite_limit; j++)
+					GFX.OBJLines[i].OBJ[j].Sprite = -1;
 		}
 
 		uint8	FirstSprite = PPU.FirstSprite;
@@ -625,45 +1197,37 @@ static void SetupOBJ (void)
 
 		do
 		{
-			if (PPU.OBJ[S].Size)
-			{
-				GFX.OBJWidths[S] = LargeWidth;
-				Height = LargeHeight;
-			}
-			else
+			if (!incremental)
 			{
-				GFX.OBJWidths[S] = SmallWidth;
-				Height = SmallHeight;
+				Height = PPU.OBJ[S].Size ? LargeHeight : SmallHeight;
+				OBJEval.CoverY[S] = (uint8) (PPU.OBJ[S].VPos & 0xff);
+				OBJEval.CoverN[S] = OBJSpriteLines(S, PPU.OBJ[S].Size ? LargeWidth : SmallWidth, Height, startline, inc);
 			}
 
-			int	HPos = PPU.OBJ[S].HPos;
-			if (HPos == -256)
-				HPos = 0;
+			uint8	Y = OBJEval.CoverY[S];
+			int		N = OBJEval.CoverN[S];
 
-			if (HPos > -GFX.OBJWidths[S] && HPos <= 256)
+			// Cheap reject for sprites wholly outside the dirty span.
+			if (incremental && Y + N <= 256 && (Y > DirtyMax || Y + N <= DirtyMin))
+				N = 0;
+
+			for (int k = 0, line = startline; k < N; k++, Y++, line += inc)
 			{
-				if (HPos < 0)
-					GFX.OBJVisibleTiles[S] = (GFX.OBJWidths[S] + HPos + 7) >> 3;
-				else if (HPos + GFX.OBJWidths[S] > 255)
-					GFX.OBJVisibleTiles[S] = (256 - HPos + 7) >> 3;
-				else
-					GFX.OBJVisibleTiles[S] = GFX.OBJWidths[S] >> 3;
+				if (Y >= SNES_HEIGHT_EXTENDED || !LineDirty[Y])
+					continue;
 
-				for (uint8 line = startline, Y = (uint8) (PPU.OBJ[S].VPos & 0xff); line < Height; Y++, line += inc)
+				if (LineOBJ[Y] >= sprite_limit)
 				{
-					if (Y >= SNES_HEIGHT_EXTENDED)
-						continue;
+					OBJEval.RTO[Y] |= 0x40;
+					continue;
+				}
 
-					if (LineOBJ[Y] >= sprite_limit)
-					{
-						GFX.OBJLines[Y].RTOFlags |= 0x40;
-						continue;
-					}
-
-					GFX.OBJLines[Y].Tiles -= GFX.OBJVisibleTiles[S];
-					if (GFX.OBJLines[Y].Tiles < 0)
-						GFX.OBJLines[Y].RTOFlags |= 0x80;
+				GFX.OBJLines[Y].Tiles -= GFX.OBJVisibleTiles[S];
+				if (GFX.OBJLines[Y].Tiles < 0)
+					OBJEval.RTO[Y] |= 0x80;
 
+				if (Lists)
+				{
 					GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Sprite = S;
 					if (PPU.OBJ[S].VFlip)
 						// Yes, Width not Height. It so happens that the
@@ -671,16 +1235,23 @@ static void SetupOBJ (void)
 						GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Line = line ^ (GFX.OBJWidths[S] - 1);
 					else
 						GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Line = line;
-
-					LineOBJ[Y]++;
 				}
+
+				LineOBJ[Y]++;
 			}
 
 			S = (S + 1) & 0x7f;
 		} while (S != FirstSprite);
 
+		GFX.OBJLines[0].RTOFlags = OBJEval.RTO[0];
 		for (int Y = 1; Y < SNES_HEIGHT_EXTENDED; Y++)
-			GFX.OBJLines[Y].RTOFlags |= GFX.OBJLines[Y - 1].RTOFlags;
+			GFX.OBJLines[Y].RTOFlags = OBJEval.RTO[Y] | GFX.OBJLines[Y - 1].RTOFlags;
+
+		OBJEval.Valid = Lists;
+		OBJEval.Normal = TRUE;
+		OBJEval.StartLine = startline;
+		OBJEval.Inc = inc;
+		OBJEval.MaxTiles = Settings.MaxSpriteTilesPerLine;
 	}
 	else // evil FirstSprite+Y case
 	{
@@ -777,9 +1348,13 @@ static void SetupOBJ (void)
 			if (j < sprite_limit)
 				GFX.OBJLines[Y].OBJ[j].Sprite = -1;
 		}
+
+		OBJEval.Valid = TRUE;
+		OBJEval.Normal = FALSE;
 	}
 
 	IPPU.OBJChanged = FALSE;
+	memset(IPPU.OBJDirty, 0, sizeof(IPPU.OBJDirty));
 }
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -883,223 +1458,325 @@ static void DrawOBJS (int D)
 #pragma GCC pop_options
 #endif
 
-static void DrawBackground (int bg, uint8 Zh, uint8 Zl)
+// Per-band tilemap decode, shared by the main and sub screen passes.
+// When the subscreen is rendered, both RenderScreen calls of one
+// S9xUpdateScreen walk the same tilemap rows for every BG enabled on
+// both screens; only the clip windows, depths and math differ. The
+// decode stage below resolves each band of lines into one descriptor
+// per 8-pixel column holding the final tile word handed to the tile
+// renderers (16x16 half and flips applied, so tile number, palette and
+// priority are all in it) and the cached tile line to start from. The
+// offset-per-tile lookups of modes 2/4/6 are resolved here as well, so
+// the draw loop is the same for both. Descriptors are tagged with
+// BGBandSerial, bumped once per S9xUpdateScreen, and the second pass
+// reuses them.
+
+struct SBGColumn
 {
-	BG.TileAddress = PPU.BG[bg].NameBase << 1;
+	uint16	Tile;
+	uint8	VirtAlign;		// first cached line of the tile, << 3
+	uint8	InterlaceLine;
+};
 
-	uint32	Tile;
-	uint16	*SC0, *SC1, *SC2, *SC3;
+struct SBGBand
+{
+	uint32	Y;
+	uint32	Lines;
+	uint32	FineX;			// column c covers screen x [8c - FineX, 8c - FineX + 8)
+	struct SBGColumn	Column[33];
+};
 
-	SC0 = (uint16 *) &Memory.VRAM[PPU.BG[bg].SCBase << 1];
-	SC1 = (PPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
-	if (SC1 >= (uint16 *) (Memory.VRAM + 0x10000))
-		SC1 -= 0x8000;
-	SC2 = (PPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
-	if (SC2 >= (uint16 *) (Memory.VRAM + 0x10000))
-		SC2 -= 0x8000;
-	SC3 = (PPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
-	if (SC3 >= (uint16 *) (Memory.VRAM + 0x10000))
-		SC3 -= 0x8000;
+static S9X_TLS struct
+{
+	uint32	Serial;
+	int		Count;
+	struct SBGBand	Band[SNES_HEIGHT_EXTENDED];
+}	BGBands[4];
 
-	uint32	Lines;
-	int		OffsetMask  = (BG.TileSizeH == 16) ? 0x3ff : 0x1ff;
-	int		OffsetShift = (BG.TileSizeV == 16) ? 4 : 3;
-	int		PixWidth = IPPU.QuadWidthPixels ? 4 : (IPPU.DoubleWidthPixels ? 2 : 1);
+
+static void GetTilemapQuadrants (int bg, uint16 **SC)
+{
+	SC[0] = (uint16 *) &Memory.VRAM[PPU.BG[bg].SCBase << 1];
+	SC[1] = (PPU.BG[bg].SCSize & 1) ? SC[0] + 1024 : SC[0];
+	if (SC[1] >= (uint16 *) (Memory.VRAM + 0x10000))
+		SC[1] -= 0x8000;
+	SC[2] = (PPU.BG[bg].SCSize & 2) ? SC[1] + 1024 : SC[0];
+	if (SC[2] >= (uint16 *) (Memory.VRAM + 0x10000))
+		SC[2] -= 0x8000;
+	SC[3] = (PPU.BG[bg].SCSize & 1) ? SC[2] + 1024 : SC[2];
+	if (SC[3] >= (uint16 *) (Memory.VRAM + 0x10000))
+		SC[3] -= 0x8000;
+}
+
+// Fills column c of a band with tilemap entry HTile (in 8-pixel units)
+// of the row at VOffset + Y2.
+static inline void DecodeColumn (struct SBGColumn *c, uint16 **SC, uint32 HTile, uint32 VOffset, uint32 Y2, bool8 HiresInterlace)
+{
+	uint32	TilemapRow = (VOffset + Y2) >> ((BG.TileSizeV == 16) ? 4 : 3);
+	uint16	*b1, *b2, *t;
+
+	if (TilemapRow & 0x20)
+	{
+		b1 = SC[2];
+		b2 = SC[3];
+	}
+	else
+	{
+		b1 = SC[0];
+		b2 = SC[1];
+	}
+
+	b1 += (TilemapRow & 0x1f) << 5;
+	b2 += (TilemapRow & 0x1f) << 5;
+
+	if (BG.TileSizeH == 8)
+	{
+		HTile &= 0x3f;
+		t = (HTile > 31) ? b2 + (HTile & 0x1f) : b1 + HTile;
+	}
+	else
+	{
+		HTile &= 0x7f;
+		t = (HTile > 63) ? b2 + ((HTile >> 1) & 0x1f) : b1 + (HTile >> 1);
+	}
+
+	uint32	Tile = READ_WORD(t);
+
+	if (BG.TileSizeV == 16)
+	{
+		uint32	half = ((VOffset + Y2) & 8) ? 16 : 0;
+		Tile = TILE_PLUS(Tile, ((Tile & V_FLIP) ? 16 - half : half));
+	}
+
+	if (BG.TileSizeH == 16)
+		Tile = TILE_PLUS(Tile, ((Tile & H_FLIP) ? 1 - (HTile & 1) : (HTile & 1)));
+
+	c->Tile = Tile;
+	c->VirtAlign = (((Y2 + VOffset) & 7) >> (HiresInterlace ? 1 : 0)) << 3;
+	c->InterlaceLine = ((VOffset + Y2) & 1) << 3;
+}
+
+static void DecodeBackground (int bg)
+{
+	uint16	*SC[4];
 	bool8	HiresInterlace = IPPU.Interlace && IPPU.DoubleWidthPixels;
+	int		OffsetMask = (BG.TileSizeH == 16) ? 0x3ff : 0x1ff;
+	uint32	Lines;
+	int		n = 0;
 
-	void (*DrawTile) (uint32, uint32, uint32, uint32);
-	void (*DrawClippedTile) (uint32, uint32, uint32, uint32, uint32, uint32);
+	GetTilemapQuadrants(bg, SC);
 
-	for (int clip = 0; clip < GFX.Clip[bg].Count; clip++)
+	for (uint32 Y = GFX.StartY; Y <= GFX.EndY; Y += Lines, n++)
 	{
-		GFX.ClipColors = !(GFX.Clip[bg].DrawMode[clip] & 1);
+		struct SBGBand	*band = &BGBands[bg].Band[n];
+		uint32	Y2 = HiresInterlace ? Y * 2 + S9xInterlaceField() : Y;
+		uint32	VOffset = LineData[Y].BG[bg].VOffset + (HiresInterlace ? 1 : 0);
+		uint32	HOffset = LineData[Y].BG[bg].HOffset;
+		int		VirtAlign = ((Y2 + VOffset) & 7) >> (HiresInterlace ? 1 : 0);
 
-		if (BG.EnableMath && (GFX.Clip[bg].DrawMode[clip] & 2))
-		{
-			DrawTile = GFX.DrawTileMath;
-			DrawClippedTile = GFX.DrawClippedTileMath;
-		}
-		else
+		for (Lines = 1; Lines < GFX.LinesPerTile - VirtAlign; Lines++)
 		{
-			DrawTile = GFX.DrawTileNomath;
-			DrawClippedTile = GFX.DrawClippedTileNomath;
+			if ((VOffset != LineData[Y + Lines].BG[bg].VOffset) || (HOffset != LineData[Y + Lines].BG[bg].HOffset))
+				break;
 		}
 
-		for (uint32 Y = GFX.StartY; Y <= GFX.EndY; Y += Lines)
-		{
-			uint32	Y2 = HiresInterlace ? Y * 2 + S9xInterlaceField() : Y;
-			uint32	VOffset = LineData[Y].BG[bg].VOffset + (HiresInterlace ? 1 : 0);
-			uint32	HOffset = LineData[Y].BG[bg].HOffset;
-			int		VirtAlign = ((Y2 + VOffset) & 7) >> (HiresInterlace ? 1 : 0);
+		if (Y + Lines > GFX.EndY)
+			Lines = GFX.EndY - Y + 1;
 
-			for (Lines = 1; Lines < GFX.LinesPerTile - VirtAlign; Lines++)
-			{
-				if ((VOffset != LineData[Y + Lines].BG[bg].VOffset) || (HOffset != LineData[Y + Lines].BG[bg].HOffset))
-					break;
-			}
+		band->Y = Y;
+		band->Lines = Lines;
+		band->FineX = HOffset & 7;
 
-			if (Y + Lines > GFX.EndY)
-				Lines = GFX.EndY - Y + 1;
+		uint32	HTile = (HOffset & OffsetMask) >> 3;
 
-			VirtAlign <<= 3;
+		for (int c = 0; c < 33; c++)
+			DecodeColumn(&band->Column[c], SC, HTile + c, VOffset, Y2, HiresInterlace);
+	}
 
-			uint32	t1, t2;
-			uint32	TilemapRow = (VOffset + Y2) >> OffsetShift;
-			BG.InterlaceLine = ((VOffset + Y2) & 1) << 3;
+	BGBands[bg].Count = n;
+}
 
-			if ((VOffset + Y2) & 8)
-			{
-				t1 = 16;
-				t2 = 0;
-			}
-			else
-			{
-				t1 = 0;
-				t2 = 16;
-			}
+static void DecodeBackgroundOffset (int bg, int VOffOff)
+{
+	uint16	*SC[4], *BPS[4];
+	bool8	HiresInterlace = IPPU.Interlace && IPPU.DoubleWidthPixels;
+	int		Offset2Mask  = (BG.OffsetSizeH == 16) ? 0x3ff : 0x1ff;
+	int		Offset2Shift = (BG.OffsetSizeV == 16) ? 4 : 3;
+	int		OffsetEnableMask = 0x2000 << bg;
+	int		n = 0;
 
-			uint16	*b1, *b2;
+	GetTilemapQuadrants(bg, SC);
+	GetTilemapQuadrants(2, BPS);
 
-			if (TilemapRow & 0x20)
-			{
-				b1 = SC2;
-				b2 = SC3;
-			}
-			else
-			{
-				b1 = SC0;
-				b2 = SC1;
-			}
+	for (uint32 Y = GFX.StartY; Y <= GFX.EndY; Y++, n++)
+	{
+		struct SBGBand	*band = &BGBands[bg].Band[n];
+		uint32	Y2 = HiresInterlace ? Y * 2 + S9xInterlaceField() : Y;
+		uint32	VOff = LineData[Y].BG[2].VOffset - 1;
+		uint32	HOff = LineData[Y].BG[2].HOffset;
+		uint32	HOffsetRow = VOff >> Offset2Shift;
+		uint32	VOffsetRow = (VOff + VOffOff) >> Offset2Shift;
+		uint32	HScroll = LineData[Y].BG[bg].HOffset;
+		uint16	*s, *s1, *s2;
+
+		if (HOffsetRow & 0x20)
+		{
+			s1 = BPS[2];
+			s2 = BPS[3];
+		}
+		else
+		{
+			s1 = BPS[0];
+			s2 = BPS[1];
+		}
 
-			b1 += (TilemapRow & 0x1f) << 5;
-			b2 += (TilemapRow & 0x1f) << 5;
+		s1 += (HOffsetRow & 0x1f) << 5;
+		s2 += (HOffsetRow & 0x1f) << 5;
+		s = ((VOffsetRow & 0x20) ? BPS[2] : BPS[0]) + ((VOffsetRow & 0x1f) << 5);
+		int32	VOffsetOffset = s - s1;
 
-			uint32	Left   = GFX.Clip[bg].Left[clip];
-			uint32	Right  = GFX.Clip[bg].Right[clip];
-			uint32	Offset = Left * PixWidth + Y * GFX.PPL;
-			uint32	HPos   = (HOffset + Left) & OffsetMask;
-			uint32	HTile  = HPos >> 3;
-			uint16	*t;
+		band->Y = Y;
+		band->Lines = 1;
+		band->FineX = HScroll & 7;
 
-			if (BG.TileSizeH == 8)
+		for (int c = 0; c < 33; c++)
+		{
+			uint32	VOffset, HOffset;
+
+			if (c == 0)
 			{
-				if (HTile > 31)
-					t = b2 + (HTile & 0x1f);
-				else
-					t = b1 + HTile;
+				// SNES cannot do OPT for leftmost tile column
+				VOffset = LineData[Y].BG[bg].VOffset;
+				HOffset = HScroll;
 			}
 			else
 			{
-				if (HTile > 63)
-					t = b2 + ((HTile >> 1) & 0x1f);
-				else
-					t = b1 + (HTile >> 1);
-			}
-
-			uint32	Width = Right - Left;
-
-			if (HPos & 7)
-			{
-				uint32	l = HPos & 7;
-				uint32	w = 8 - l;
-				if (w > Width)
-					w = Width;
-
-				Offset -= l * PixWidth;
-				Tile = READ_WORD(t);
-				GFX.Z1 = GFX.Z2 = (Tile & 0x2000) ? Zh : Zl;
-
-				if (BG.TileSizeV == 16)
-					Tile = TILE_PLUS(Tile, ((Tile & V_FLIP) ? t2 : t1));
+				// The offset entry is fetched once per BG column, from
+				// the BG3 position just left of the column's first pixel.
+				int HOffTile = ((HOff + 8 * c - band->FineX - 1) & Offset2Mask) >> 3;
 
-				if (BG.TileSizeH == 8)
+				if (BG.OffsetSizeH == 8)
 				{
-					DrawClippedTile(Tile, Offset, l, w, VirtAlign, Lines);
-					t++;
-					if (HTile == 31)
-						t = b2;
+					if (HOffTile > 31)
+						s = s2 + (HOffTile & 0x1f);
 					else
-					if (HTile == 63)
-						t = b1;
+						s = s1 + HOffTile;
 				}
 				else
 				{
-					if (!(Tile & H_FLIP))
-						DrawClippedTile(TILE_PLUS(Tile, (HTile & 1)), Offset, l, w, VirtAlign, Lines);
-					else
-						DrawClippedTile(TILE_PLUS(Tile, 1 - (HTile & 1)), Offset, l, w, VirtAlign, Lines);
-					t += HTile & 1;
-					if (HTile == 63)
-						t = b2;
+					if (HOffTile > 63)
+						s = s2 + ((HOffTile >> 1) & 0x1f);
 					else
-					if (HTile == 127)
-						t = b1;
+						s = s1 + (HOffTile >> 1);
 				}
 
-				HTile++;
-				Offset += 8 * PixWidth;
-				Width -= w;
-			}
-
-			while (Width >= 8)
-			{
-				Tile = READ_WORD(t);
-				GFX.Z1 = GFX.Z2 = (Tile & 0x2000) ? Zh : Zl;
+				uint16	HCellOffset = READ_WORD(s);
+				uint16	VCellOffset;
 
-				if (BG.TileSizeV == 16)
-					Tile = TILE_PLUS(Tile, ((Tile & V_FLIP) ? t2 : t1));
-
-				if (BG.TileSizeH == 8)
-				{
-					DrawTile(Tile, Offset, VirtAlign, Lines);
-					t++;
-					if (HTile == 31)
-						t = b2;
-					else
-					if (HTile == 63)
-						t = b1;
-				}
+				if (VOffOff)
+					VCellOffset = READ_WORD(s + VOffsetOffset);
 				else
 				{
-					if (!(Tile & H_FLIP))
-						DrawTile(TILE_PLUS(Tile, (HTile & 1)), Offset, VirtAlign, Lines);
-					else
-						DrawTile(TILE_PLUS(Tile, 1 - (HTile & 1)), Offset, VirtAlign, Lines);
-					t += HTile & 1;
-					if (HTile == 63)
-						t = b2;
+					if (HCellOffset & 0x8000)
+					{
+						VCellOffset = HCellOffset;
+						HCellOffset = 0;
+					}
 					else
-					if (HTile == 127)
-						t = b1;
+						VCellOffset = 0;
 				}
 
-				HTile++;
-				Offset += 8 * PixWidth;
-				Width -= 8;
+				if (VCellOffset & OffsetEnableMask)
+					VOffset = VCellOffset + 1;
+				else
+					VOffset = LineData[Y].BG[bg].VOffset;
+
+				if (HCellOffset & OffsetEnableMask)
+					HOffset = (HCellOffset & ~7) | (HScroll & 7);
+				else
+					HOffset = HScroll;
 			}
 
-			if (Width)
+			if (HiresInterlace)
+				VOffset++;
+
+			// HOffset keeps HScroll's fine bits, so column c of this BG
+			// starts at the same screen x whether or not OPT moved it.
+			DecodeColumn(&band->Column[c], SC, (HOffset >> 3) + c, VOffset, Y2, HiresInterlace);
+		}
+	}
+
+	BGBands[bg].Count = n;
+}
+
+// Draws a BG from its band descriptors through the current clip windows.
+static void DrawBackgroundBands (int bg, uint8 Zh, uint8 Zl)
+{
+	BG.TileAddress = PPU.BG[bg].NameBase << 1;
+
+	int	PixWidth = IPPU.QuadWidthPixels ? 4 : (IPPU.DoubleWidthPixels ? 2 : 1);
+
+	void (*DrawTile) (uint32, uint32, uint32, uint32);
+	void (*DrawClippedTile) (uint32, uint32, uint32, uint32, uint32, uint32);
+
+	for (int clip = 0; clip < GFX.Clip[bg].Count; clip++)
+	{
+		GFX.ClipColors = !(GFX.Clip[bg].DrawMode[clip] & 1);
+
+		if (BG.EnableMath && (GFX.Clip[bg].DrawMode[clip] & 2))
+		{
+			DrawTile = GFX.DrawTileMath;
+			DrawClippedTile = GFX.DrawClippedTileMath;
+		}
+		else
+		{
+			DrawTile = GFX.DrawTileNomath;
+			DrawClippedTile = GFX.DrawClippedTileNomath;
+		}
+
+		uint32	Left  = GFX.Clip[bg].Left[clip];
+		uint32	Right = GFX.Clip[bg].Right[clip];
+
+		for (int n = 0; n < BGBands[bg].Count; n++)
+		{
+			const struct SBGBand	*band = &BGBands[bg].Band[n];
+			uint32	RowOffset = band->Y * GFX.PPL;
+
+			for (uint32 x = Left; x < Right; )
 			{
-				Tile = READ_WORD(t);
-				GFX.Z1 = GFX.Z2 = (Tile & 0x2000) ? Zh : Zl;
+				uint32	l = (band->FineX + x) & 7;
+				uint32	w = 8 - l;
+				if (w > Right - x)
+					w = Right - x;
 
-				if (BG.TileSizeV == 16)
-					Tile = TILE_PLUS(Tile, ((Tile & V_FLIP) ? t2 : t1));
+				const struct SBGColumn	*c = &band->Column[(band->FineX + x) >> 3];
+				uint32	Offset = RowOffset + (x - l) * PixWidth;
 
-				if (BG.TileSizeH == 8)
-					DrawClippedTile(Tile, Offset, 0, Width, VirtAlign, Lines);
+				GFX.Z1 = GFX.Z2 = (c->Tile & 0x2000) ? Zh : Zl;
+				BG.InterlaceLine = c->InterlaceLine;
+
+				if (w == 8)
+					DrawTile(c->Tile, Offset, c->VirtAlign, band->Lines);
 				else
-				{
-					if (!(Tile & H_FLIP))
-						DrawClippedTile(TILE_PLUS(Tile, (HTile & 1)), Offset, 0, Width, VirtAlign, Lines);
-					else
-						DrawClippedTile(TILE_PLUS(Tile, 1 - (HTile & 1)), Offset, 0, Width, VirtAlign, Lines);
-				}
+					DrawClippedTile(c->Tile, Offset, l, w, c->VirtAlign, band->Lines);
+
+				x += w;
 			}
 		}
 	}
 }
 
+static void DrawBackground (int bg, uint8 Zh, uint8 Zl)
+{
+	if (BGBands[bg].Serial != BGBandSerial)
+	{
+		DecodeBackground(bg);
+		BGBands[bg].Serial = BGBandSerial;
+	}
+
+	DrawBackgroundBands(bg, Zh, Zl);
+}
+
 static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 {
 	BG.TileAddress = PPU.BG[bg].NameBase << 1;
@@ -1268,230 +1945,13 @@ static void DrawBackgroundMosaic (int bg, uint8 Zh, uint8 Zl)
 
 static void DrawBackgroundOffset (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 {
-	BG.TileAddress = PPU.BG[bg].NameBase << 1;
-
-	uint32	Tile;
-	uint16	*SC0, *SC1, *SC2, *SC3;
-	uint16	*BPS0, *BPS1, *BPS2, *BPS3;
-
-	BPS0 = (uint16 *) &Memory.VRAM[PPU.BG[2].SCBase << 1];
-	BPS1 = (PPU.BG[2].SCSize & 1) ? BPS0 + 1024 : BPS0;
-	if (BPS1 >= (uint16 *) (Memory.VRAM + 0x10000))
-		BPS1 -= 0x8000;
-	BPS2 = (PPU.BG[2].SCSize & 2) ? BPS1 + 1024 : BPS0;
-	if (BPS2 >= (uint16 *) (Memory.VRAM + 0x10000))
-		BPS2 -= 0x8000;
-	BPS3 = (PPU.BG[2].SCSize & 1) ? BPS2 + 1024 : BPS2;
-	if (BPS3 >= (uint16 *) (Memory.VRAM + 0x10000))
-		BPS3 -= 0x8000;
-
-	SC0 = (uint16 *) &Memory.VRAM[PPU.BG[bg].SCBase << 1];
-	SC1 = (PPU.BG[bg].SCSize & 1) ? SC0 + 1024 : SC0;
-	if (SC1 >= (uint16 *) (Memory.VRAM + 0x10000))
-		SC1 -= 0x8000;
-	SC2 = (PPU.BG[bg].SCSize & 2) ? SC1 + 1024 : SC0;
-	if (SC2 >= (uint16 *) (Memory.VRAM + 0x10000))
-		SC2 -= 0x8000;
-	SC3 = (PPU.BG[bg].SCSize & 1) ? SC2 + 1024 : SC2;
-	if (SC3 >= (uint16 *) (Memory.VRAM + 0x10000))
-		SC3 -= 0x8000;
-
-	int	OffsetMask   = (BG.TileSizeH   == 16) ? 0x3ff : 0x1ff;
-	int	OffsetShift  = (BG.TileSizeV   == 16) ? 4 : 3;
-	int	Offset2Mask  = (BG.OffsetSizeH == 16) ? 0x3ff : 0x1ff;
-	int	Offset2Shift = (BG.OffsetSizeV == 16) ? 4 : 3;
-	int	OffsetEnableMask = 0x2000 << bg;
-	int	PixWidth = IPPU.QuadWidthPixels ? 4 : (IPPU.DoubleWidthPixels ? 2 : 1);
-	bool8	HiresInterlace = IPPU.Interlace && IPPU.DoubleWidthPixels;
-
-	void (*DrawClippedTile) (uint32, uint32, uint32, uint32, uint32, uint32);
-
-	for (int clip = 0; clip < GFX.Clip[bg].Count; clip++)
+	if (BGBands[bg].Serial != BGBandSerial)
 	{
-		GFX.ClipColors = !(GFX.Clip[bg].DrawMode[clip] & 1);
-
-		if (BG.EnableMath && (GFX.Clip[bg].DrawMode[clip] & 2))
-		{
-			DrawClippedTile = GFX.DrawClippedTileMath;
-		}
-		else
-		{
-			DrawClippedTile = GFX.DrawClippedTileNomath;
-		}
-
-		for (uint32 Y = GFX.StartY; Y <= GFX.EndY; Y++)
-		{
-			uint32	Y2 = HiresInterlace ? Y * 2 + S9xInterlaceField() : Y;
-			uint32	VOff = LineData[Y].BG[2].VOffset - 1;
-			uint32	HOff = LineData[Y].BG[2].HOffset;
-			uint32	HOffsetRow = VOff >> Offset2Shift;
-			uint32	VOffsetRow = (VOff + VOffOff) >> Offset2Shift;
-			uint16	*s, *s1, *s2;
-
-			if (HOffsetRow & 0x20)
-			{
-				s1 = BPS2;
-				s2 = BPS3;
-			}
-			else
-			{
-				s1 = BPS0;
-				s2 = BPS1;
-			}
-
-			s1 += (HOffsetRow & 0x1f) << 5;
-			s2 += (HOffsetRow & 0x1f) << 5;
-			s = ((VOffsetRow & 0x20) ? BPS2 : BPS0) + ((VOffsetRow & 0x1f) << 5);
-			int32	VOffsetOffset = s - s1;
-
-			uint32	Left  = GFX.Clip[bg].Left[clip];
-			uint32	Right = GFX.Clip[bg].Right[clip];
-			uint32	Offset = Left * PixWidth + Y * GFX.PPL;
-			uint32	HScroll = LineData[Y].BG[bg].HOffset;
-			bool8	left_edge = (Left < (8 - (HScroll & 7)));
-			uint32	Width = Right - Left;
-
-			while (Left < Right)
-			{
-				uint32	VOffset, HOffset;
-
-				if (left_edge)
-				{
-					// SNES cannot do OPT for leftmost tile column
-					VOffset = LineData[Y].BG[bg].VOffset;
-					HOffset = HScroll;
-					left_edge = FALSE;
-				}
-				else
-				{
-					int HOffTile = ((HOff + Left - 1) & Offset2Mask) >> 3;
-
-					if (BG.OffsetSizeH == 8)
-					{
-						if (HOffTile > 31)
-							s = s2 + (HOffTile & 0x1f);
-						else
-							s = s1 + HOffTile;
-					}
-					else
-					{
-						if (HOffTile > 63)
-							s = s2 + ((HOffTile >> 1) & 0x1f);
-						else
-							s = s1 + (HOffTile >> 1);
-					}
-
-					uint16	HCellOffset = READ_WORD(s);
-					uint16	VCellOffset;
-
-					if (VOffOff)
-						VCellOffset = READ_WORD(s + VOffsetOffset);
-					else
-					{
-						if (HCellOffset & 0x8000)
-						{
-							VCellOffset = HCellOffset;
-							HCellOffset = 0;
-						}
-						else
-							VCellOffset = 0;
-					}
-
-					if (VCellOffset & OffsetEnableMask)
-						VOffset = VCellOffset + 1;
-					else
-						VOffset = LineData[Y].BG[bg].VOffset;
-
-					if (HCellOffset & OffsetEnableMask)
-						HOffset = (HCellOffset & ~7) | (HScroll & 7);
-					else
-						HOffset = HScroll;
-				}
-
-				if (HiresInterlace)
-					VOffset++;
-
-				uint32	t1, t2;
-				int		VirtAlign = (((Y2 + VOffset) & 7) >> (HiresInterlace ? 1 : 0)) << 3;
-				int		TilemapRow = (VOffset + Y2) >> OffsetShift;
-				BG.InterlaceLine = ((VOffset + Y2) & 1) << 3;
-
-				if ((VOffset + Y2) & 8)
-				{
-					t1 = 16;
-					t2 = 0;
-				}
-				else
-				{
-					t1 = 0;
-					t2 = 16;
-				}
-
-				uint16	*b1, *b2;
-
-				if (TilemapRow & 0x20)
-				{
-					b1 = SC2;
-					b2 = SC3;
-				}
-				else
-				{
-					b1 = SC0;
-					b2 = SC1;
-				}
-
-				b1 += (TilemapRow & 0x1f) << 5;
-				b2 += (TilemapRow & 0x1f) << 5;
-
-				uint32	HPos = (HOffset + Left) & OffsetMask;
-				uint32	HTile = HPos >> 3;
-				uint16	*t;
-
-				if (BG.TileSizeH == 8)
-				{
-					if (HTile > 31)
-						t = b2 + (HTile & 0x1f);
-					else
-						t = b1 + HTile;
-				}
-				else
-				{
-					if (HTile > 63)
-						t = b2 + ((HTile >> 1) & 0x1f);
-					else
-						t = b1 + (HTile >> 1);
-				}
-
-				uint32	l = HPos & 7;
-				uint32	w = 8 - l;
-				if (w > Width)
-					w = Width;
-
-				Offset -= l * PixWidth;
-				Tile = READ_WORD(t);
-				GFX.Z1 = GFX.Z2 = (Tile & 0x2000) ? Zh : Zl;
-
-				if (BG.TileSizeV == 16)
-					Tile = TILE_PLUS(Tile, ((Tile & V_FLIP) ? t2 : t1));
-
-				if (BG.TileSizeH == 8)
-				{
-					DrawClippedTile(Tile, Offset, l, w, VirtAlign, 1);
-				}
-				else
-				{
-					if (!(Tile & H_FLIP))
-						DrawClippedTile(TILE_PLUS(Tile, (HTile & 1)), Offset, l, w, VirtAlign, 1);
-					else
-						DrawClippedTile(TILE_PLUS(Tile, 1 - (HTile & 1)), Offset, l, w, VirtAlign, 1);
-				}
-
-				Left += w;
-				Offset += 8 * PixWidth;
-				Width -= w;
-			}
-		}
+		DecodeBackgroundOffset(bg, VOffOff);
+		BGBands[bg].Serial = BGBandSerial;
 	}
+
+	DrawBackgroundBands(bg, Zh, Zl);
 }
 
 static void DrawBackgroundOffsetMosaic (int bg, uint8 Zh, uint8 Zl, int VOffOff)
@@ -1725,11 +2185,12 @@ static void DrawBackgroundOffsetMosaic (int bg, uint8 Zh, uint8 Zl, int VOffOff)
 static inline void DrawBackgroundMode7 (int bg, void (*DrawMath) (uint32, uint32, int), void (*DrawNomath) (uint32, uint32, int), int D)
 {
 	/* The C tile renderer samples Mode 7 through de-interleaved
-	   tilemap/graphics planes (Mode7TileMap/Mode7Gfx in tile.c); refresh
-	   them from current VRAM before sampling, exactly where snes9x2010's
-	   caller does. VRAM is VBlank-stable across a frame's Mode 7
-	   rendering, so one snapshot covers every clip segment below. */
-	S9xMode7DeinterleaveVRAM();
+	   tilemap/graphics planes (Mode7TileMap/Mode7Gfx in tile.c); bring the
+	   pages VRAM writes have touched up to date before sampling, exactly
+	   where snes9x2010's caller refreshes them. VRAM is VBlank-stable
+	   across a frame's Mode 7 rendering, so this covers every clip
+	   segment below. */
+	S9xMode7DeinterleaveVRAM(IPPU.Mode7Cached);
 
 	for (int clip = 0; clip < GFX.Clip[bg].Count; clip++)
 	{
@@ -1792,25 +2253,40 @@ static uint16 get_crosshair_color (uint8 color)
 
 void S9xDrawCrosshair (const char *crosshair, uint8 fgcolor, uint8 bgcolor, int16 x, int16 y)
 {
-	if (!crosshair)
+	if (!crosshair || Crosshairs.Count == (int) (sizeof(Crosshairs.Item) / sizeof(Crosshairs.Item[0])))
 		return;
 
-	int16	r, rx = 1, c, cx = 1, W = SNES_WIDTH, H = PPU.ScreenHeight;
-	uint16	fg, bg;
+	// Drawn over the frame after it was compared, so it can't be a dupe.
+	IPPU.ScreenDirty = TRUE;
 
-	x -= 7;
-	y -= 7;
+	Crosshairs.Lines = PPU.ScreenHeight;
+	Crosshairs.Item[Crosshairs.Count].Image = crosshair;
+	Crosshairs.Item[Crosshairs.Count].FG = fgcolor;
+	Crosshairs.Item[Crosshairs.Count].BG = bgcolor;
+	Crosshairs.Item[Crosshairs.Count].X = x;
+	Crosshairs.Item[Crosshairs.Count].Y = y;
+	Crosshairs.Count++;
+}
+
+const struct SCrosshairs * S9xFrameCrosshairs (void)
+{
+	return (&Crosshairs);
+}
+
+static void DrawCrosshairAt (uint16 *screen, uint32 ppl, int16 W, int16 H, int16 cx, int16 rx, const char *crosshair, uint8 fgcolor, uint8 bgcolor, int16 x, int16 y)
+{
+	int16	r, c;
+	uint16	fg, bg;
 
-	if (IPPU.QuadWidthPixels)         { cx = 4; x *= 4; W *= 4; }
-	else if (IPPU.DoubleWidthPixels)  { cx = 2; x *= 2; W *= 2; }
-	if (IPPU.DoubleHeightPixels) { rx = 2; y *= 2; H *= 2; }
+	x = (x - 7) * cx;
+	y = (y - 7) * rx;
 
 	fg = get_crosshair_color(fgcolor);
 	bg = get_crosshair_color(bgcolor);
 
-	uint16	*s = GFX.Screen + y * (int32)GFX.RealPPL + x;
+	uint16	*s = screen + y * (int32)ppl + x;
 
-	for (r = 0; r < 15 * rx; r++, s += GFX.RealPPL - 15 * cx)
+	for (r = 0; r < 15 * rx; r++, s += ppl - 15 * cx)
 	{
 		if (y + r < 0)
 		{
@@ -1823,7 +2299,7 @@ void S9xDrawCrosshair (const char *crosshair, uint8 fgcolor, uint8 bgcolor, int1
 
 		for (c = 0; c < 15 * cx; c++, s++)
 		{
-			if (x + c < 0 || s < GFX.Screen)
+			if (x + c < 0 || s < screen)
 				continue;
 
 			if (x + c >= W)
@@ -1843,3 +2319,15 @@ void S9xDrawCrosshair (const char *crosshair, uint8 fgcolor, uint8 bgcolor, int1
 	}
 }
 
+void S9xDrawCrosshairs (uint16 *screen, uint32 ppl, int width, int height, const struct SCrosshairs *crosshairs)
+{
+	if (!crosshairs->Count)
+		return;
+
+	int16	cx = width / SNES_WIDTH, rx = height / crosshairs->Lines;
+
+	for (int i = 0; i < crosshairs->Count; i++)
+		DrawCrosshairAt(screen, ppl, SNES_WIDTH * cx, crosshairs->Lines * rx, cx, rx, crosshairs->Item[i].Image,
+						crosshairs->Item[i].FG, crosshairs->Item[i].BG, crosshairs->Item[i].X, crosshairs->Item[i].Y);
+}
+
@@ -37,8 +37,8 @@ struct SGFX
 {
 	/* Pitch/RealPPL/ScreenSize were C++11 in-class consts and ScreenBuffer
 	   a std::vector; both made this struct invisible to C. Plain fields
-	   now, set in S9xGraphicsInit before anything reads them; the screen
-	   allocation lives in gfx.cpp (GFXScreenBuffer). */
+	   now, set with the screen buffers at the start of the first frame
+	   drawn; the screen allocation lives in gfx.cpp (GFXScreenBuffer). */
 	uint32	Pitch;
 	uint32	RealPPL;
 	uint32	ScreenSize;
@@ -48,7 +48,7 @@ struct SGFX
 	uint8	*SubZBuffer;
 	uint16	*S;
 	uint8	*DB;
-	uint16	*ZERO;
+	const uint16	*ZERO;
 	uint32	PPL;				// number of pixels on each of Screen buffer
 	uint32	LinesPerTile;		// number of lines in 1 tile (4 or 8 due to interlace)
 	uint16	*ScreenColors;		// screen colors for rendering main
@@ -65,6 +65,30 @@ struct SGFX
 
 	struct ClipData	*Clip;
 
+	/* Two-phase renderer (Settings.LayeredRenderer). Phase 1 draws the
+	   main and sub screens at native width into the Layer* rows, keeping
+	   each winning pixel's un-blended colour plus LAYER_* flags; phase 2
+	   (S9xCompositeLayerLine) applies color math and writes the row at
+	   whatever width the frame ends up with. Priority and windows are
+	   still resolved in phase 1 by the Z test, and only modes 0-4 without
+	   hires, interlace or mosaic take this path. */
+	uint16	*LayerScreen;
+	uint16	*LayerSubScreen;
+	uint8	*LayerZBuffer;
+	uint8	*LayerSubZBuffer;
+	uint8	*LayerFlags;		// main rows, then sub rows (sub flags unused)
+	uint8	*LF;				// flags row of the screen being drawn, like S/DB
+	bool8	Layered;			// RenderScreen is in phase 1
+	uint16	*CheckScreen;		// LayeredRenderer == 2: the same lines drawn the direct way
+
+	struct
+	{
+		bool8	Pending;		// drawn in phase 1, not yet composited
+		bool8	Check;			// also drawn into CheckScreen, compare at end of frame
+		uint8	MathOp;			// S9xTileMathOp() when the line was drawn
+		uint16	FixedColour;
+	}	LayerLines[SNES_HEIGHT_EXTENDED];
+
 	struct
 	{
 		uint8	RTOFlags;
@@ -142,12 +166,12 @@ struct SLineMatrixData
 	short	M7VOFS;
 };
 
-extern uint16		BlackColourMap[256];
-extern uint16		DirectColourMaps[8][256];
+extern S9X_TLS uint16		BlackColourMap[256];
+extern S9X_TLS uint16		DirectColourMaps[8][256];
 extern uint8		mul_brightness[16][32];
-extern uint8		brightness_cap[64];
-extern struct SBG	BG;
-extern struct SGFX	GFX;
+extern S9X_TLS uint8		brightness_cap[64];
+extern S9X_TLS struct SBG	BG;
+extern S9X_TLS struct SGFX	GFX;
 
 #define H_FLIP		0x4000
 #define V_FLIP		0x8000
@@ -308,8 +332,11 @@ void S9xEndScreenRefresh (void);
 void S9xBuildDirectColourMaps (void);
 void RenderLine (uint8);
 void S9xComputeClipWindows (void);
+void S9xInvalidateClipWindows (void);
 void S9xDisplayChar (uint16 *, uint8);
 void S9xGraphicsScreenResize (void);
+bool8 S9xSetScreenTarget (uint16 *, uint32);
+void S9xReleaseScreenTarget (void);
 // called automatically unless Settings.AutoDisplayMessages is false
 void S9xDisplayMessages (uint16 *, int, int, int, int);
 
@@ -0,0 +1,114 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+/* XXH64, after Yann Collet's reference description. Four lanes take 32 bytes
+   a round; what is left goes in 8, 4 and 1 bytes at a time, and a final
+   avalanche mixes every input bit into every output bit. */
+
+#include <string.h>
+#include "hash64.h"
+
+#define PRIME64_1	0x9E3779B185EBCA87ULL
+#define PRIME64_2	0xC2B2AE3D27D4EB4FULL
+#define PRIME64_3	0x165667B19E3779F9ULL
+#define PRIME64_4	0x85EBCA77C2B2AE63ULL
+#define PRIME64_5	0x27D4EB2F165667C5ULL
+
+static inline uint64 Rotl64 (uint64 x, int r)
+{
+	return ((x << r) | (x >> (64 - r)));
+}
+
+static inline uint64 Read64 (const uint8 *p)
+{
+	uint64	v;
+	memcpy(&v, p, 8);
+#ifdef MSB_FIRST
+	v = ((v & 0x00000000000000FFULL) << 56) | ((v & 0x000000000000FF00ULL) << 40) |
+		((v & 0x0000000000FF0000ULL) << 24) | ((v & 0x00000000FF000000ULL) <<  8) |
+		((v & 0x000000FF00000000ULL) >>  8) | ((v & 0x0000FF0000000000ULL) >> 24) |
+		((v & 0x00FF000000000000ULL) >> 40) | ((v & 0xFF00000000000000ULL) >> 56);
+#endif
+	return (v);
+}
+
+static inline uint64 Read32 (const uint8 *p)
+{
+	return ((uint64) p[0] | ((uint64) p[1] << 8) | ((uint64) p[2] << 16) | ((uint64) p[3] << 24));
+}
+
+static inline uint64 Round (uint64 acc, uint64 input)
+{
+	acc += input * PRIME64_2;
+	acc  = Rotl64(acc, 31);
+	return (acc * PRIME64_1);
+}
+
+static inline uint64 MergeRound (uint64 acc, uint64 val)
+{
+	acc ^= Round(0, val);
+	return (acc * PRIME64_1 + PRIME64_4);
+}
+
+uint64 S9xHash64 (const void *data, size_t len, uint64 seed)
+{
+	const uint8	*p   = (const uint8 *) data;
+	const uint8	*end = p + len;
+	uint64		h;
+
+	if (len >= 32)
+	{
+		uint64	v1 = seed + PRIME64_1 + PRIME64_2;
+		uint64	v2 = seed + PRIME64_2;
+		uint64	v3 = seed;
+		uint64	v4 = seed - PRIME64_1;
+
+		for (; end - p >= 32; p += 32)
+		{
+			v1 = Round(v1, Read64(p));
+			v2 = Round(v2, Read64(p + 8));
+			v3 = Round(v3, Read64(p + 16));
+			v4 = Round(v4, Read64(p + 24));
+		}
+
+		h = Rotl64(v1, 1) + Rotl64(v2, 7) + Rotl64(v3, 12) + Rotl64(v4, 18);
+		h = MergeRound(h, v1);
+		h = MergeRound(h, v2);
+		h = MergeRound(h, v3);
+		h = MergeRound(h, v4);
+	}
+	else
+		h = seed + PRIME64_5;
+
+	h += (uint64) len;
+
+	for (; end - p >= 8; p += 8)
+	{
+		h ^= Round(0, Read64(p));
+		h  = Rotl64(h, 27) * PRIME64_1 + PRIME64_4;
+	}
+
+	if (end - p >= 4)
+	{
+		h ^= Read32(p) * PRIME64_1;
+		h  = Rotl64(h, 23) * PRIME64_2 + PRIME64_3;
+		p += 4;
+	}
+
+	for (; p < end; p++)
+	{
+		h ^= (uint64) *p * PRIME64_5;
+		h  = Rotl64(h, 11) * PRIME64_1;
+	}
+
+	h ^= h >> 33;
+	h *= PRIME64_2;
+	h ^= h >> 29;
+	h *= PRIME64_3;
+	h ^= h >> 32;
+
+	return (h);
+}
@@ -0,0 +1,18 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+#ifndef _HASH64_H_
+#define _HASH64_H_
+
+#include <stddef.h>
+#include "port.h"
+
+// XXH64: a fast, non-cryptographic 64-bit hash for fingerprints, not for
+// anything an adversary chooses. The same bytes and seed hash the same on
+// every host.
+uint64 S9xHash64 (const void *, size_t, uint64 seed = 0);
+
+#endif
@@ -5,7 +5,7 @@
 #include "libretro_core_options.h"
 
 #include "snes9x.h"
-extern "C" { extern uint8 TileMode7Hires; extern uint8 TileMode7HiresBilinear; }
+extern "C" { extern S9X_TLS uint8 TileMode7Hires; extern S9X_TLS uint8 TileMode7HiresBilinear; }
 #include "fxemu.h"
 #include "memmap.h"
 #include "srtc.h"
@@ -13,6 +13,8 @@ extern "C" { extern uint8 TileMode7Hires; extern uint8 TileMode7HiresBilinear; }
 #include "apu/bapu/snes/snes.hpp"
 #include "gfx.h"
 #include "snapshot.h"
+#include "dirty.h"
+#include "rewind.h"
 #include "controls.h"
 #include "cheats.h"
 #include "display.h"
@@ -20,6 +22,14 @@ extern "C" { extern uint8 TileMode7Hires; extern uint8 TileMode7HiresBilinear; }
 #include <stdio.h>
 #include <vector>
 #include <string>
+#include <chrono>
+#ifdef HAVE_THREADS
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#elif defined(S9X_THREAD_INSTANCES)
+#include <mutex>
+#endif
 
 #ifdef _WIN32
 #include <direct.h>
@@ -32,6 +42,7 @@ extern "C" { extern uint8 TileMode7Hires; extern uint8 TileMode7HiresBilinear; }
 #include "filter/snes_ntsc.h"
 
 static void reset_button_cache(void);
+static void init_descriptors(void);
 
 #define RETRO_DEVICE_JOYPAD_MULTITAP ((1 << 8) | RETRO_DEVICE_JOYPAD)
 #define RETRO_DEVICE_LIGHTGUN_SUPER_SCOPE ((1 << 8) | RETRO_DEVICE_LIGHTGUN)
@@ -39,8 +50,8 @@ static void reset_button_cache(void);
 #define RETRO_DEVICE_LIGHTGUN_JUSTIFIER_2 ((3 << 8) | RETRO_DEVICE_LIGHTGUN)
 #define RETRO_DEVICE_LIGHTGUN_MACS_RIFLE ((4 << 8) | RETRO_DEVICE_LIGHTGUN)
 
-static int g_screen_gun_width = SNES_WIDTH;
-static int g_screen_gun_height = SNES_HEIGHT;
+static S9X_TLS int g_screen_gun_width = SNES_WIDTH;
+static S9X_TLS int g_screen_gun_height = SNES_HEIGHT;
 
 #define RETRO_MEMORY_SNES_BSX_RAM ((1 << 8) | RETRO_MEMORY_SAVE_RAM)
 #define RETRO_MEMORY_SNES_BSX_PRAM ((2 << 8) | RETRO_MEMORY_SAVE_RAM)
@@ -58,38 +69,253 @@ static int g_screen_gun_height = SNES_HEIGHT;
 
 #define SNES_4_3 4.0f / 3.0f
 
-uint16 *screen_buffer = NULL;
+S9X_TLS uint16 *screen_buffer = NULL;
+
+S9X_TLS char g_rom_dir[1024];
+S9X_TLS char g_basename[1024];
+
+S9X_TLS bool g_geometry_update = false;
+
+S9X_TLS int hires_blend = 0;
+S9X_TLS bool randomize_memory = false;
+S9X_TLS int disabled_channels = 0;
+
+S9X_TLS char retro_system_directory[4096];
+S9X_TLS char retro_save_directory[4096];
+
+S9X_TLS retro_log_printf_t log_cb = NULL;
+static S9X_TLS retro_video_refresh_t video_cb = NULL;
+static S9X_TLS retro_audio_sample_t audio_cb = NULL;
+static S9X_TLS retro_audio_sample_batch_t audio_batch_cb = NULL;
+static S9X_TLS retro_input_poll_t poll_cb = NULL;
+static S9X_TLS retro_input_state_t input_state_cb = NULL;
+
+static S9X_TLS bool libretro_supports_option_categories = false;
+static S9X_TLS bool libretro_supports_bitmasks = false;
+static S9X_TLS bool libretro_supports_dupe = false;
+
+/* Frames are handed to the frontend through present_frame().
+   frame_presented tracks whether this retro_run produced a frame at all, for
+   the dupe below; video_wanted whether the frontend wants one from it. */
+static S9X_TLS bool frame_presented = false;
+static S9X_TLS bool video_wanted = true;
+static S9X_TLS unsigned last_video_width = SNES_WIDTH, last_video_height = SNES_HEIGHT;
+static S9X_TLS size_t last_video_pitch = 0;
+
+/* snes9x_input_poll 'late': retro_run leaves the frontend poll to the
+   game's first controller latch of the frame, so input is sampled as close
+   to the moment the game takes it as possible. The frontend's input does
+   not change within a run, so the frame's outcome does not depend on when
+   the poll lands, and a run always starts with a poll pending - nothing
+   about it needs to go into savestates. */
+static S9X_TLS bool input_poll_late = false;
+static S9X_TLS bool input_poll_pending = false;
+
+/* snes9x_runahead: frames emulated past the one the frontend asked for. The
+   snapshot is taken through the serializer's in-place path, which already
+   skips everything that cannot change between frames (ROM, tables, caches),
+   into a buffer sized once per loaded game. */
+static S9X_TLS unsigned runahead_frames = 0;
+static S9X_TLS uint8 *runahead_state = NULL;
+static S9X_TLS uint32 runahead_state_size = 0;
+
+/* snes9x_rewind: the memory given to the in-core rewind history (rewind.cpp),
+   in MB. Holding snes9x_rewind_button on the first controller steps back one
+   frame per run. */
+static S9X_TLS unsigned rewind_budget = 0;
+static S9X_TLS unsigned rewind_button = RETRO_DEVICE_ID_JOYPAD_L2;
+static S9X_TLS bool rewind_held = false; /* as of the last poll_input */
+
+/* snes9x_log_state_hash: log S9xStateHash after every frame, for finding the
+   frame where two runs of the same input part ways. */
+static S9X_TLS bool log_state_hash = false;
+
+static void video_post_finish();
+static void video_post_free_ntsc();
+#ifdef HAVE_THREADS
+static void video_post_start();
+static void video_post_stop();
+static void video_post_wait();
+static void video_post_drop();
+#endif
 
-char g_rom_dir[1024];
-char g_basename[1024];
+static S9X_TLS const snes_ntsc_t *snes_ntsc = NULL;
+static S9X_TLS int blargg_filter = 0;
 
-bool g_geometry_update = false;
+const int MAX_SNES_WIDTH_NTSC = ((SNES_NTSC_OUT_WIDTH(256) + 3) / 4) * 4;
 
-int hires_blend = 0;
-bool randomize_memory = false;
-int disabled_channels = 0;
+/* A filter table is 8 MB and depends only on its preset, so the consoles in
+   one process share one per preset (indexed by blargg_filter), counting
+   users and freeing it when the last lets go. */
+static snes_ntsc_t *ntsc_tables[6];
+static unsigned ntsc_table_users[6];
+#ifdef S9X_THREAD_INSTANCES
+static std::mutex ntsc_tables_lock;
+#endif
 
-char retro_system_directory[4096];
-char retro_save_directory[4096];
+static const snes_ntsc_t *ntsc_table_acquire(int filter, const snes_ntsc_setup_t *setup)
+{
+#ifdef S9X_THREAD_INSTANCES
+    std::lock_guard<std::mutex> lock(ntsc_tables_lock);
+#endif
+    if (!ntsc_tables[filter])
+    {
+        ntsc_tables[filter] = new snes_ntsc_t;
+        snes_ntsc_init(ntsc_tables[filter], setup);
+    }
+    ntsc_table_users[filter]++;
+    return ntsc_tables[filter];
+}
 
-retro_log_printf_t log_cb = NULL;
-static retro_video_refresh_t video_cb = NULL;
-static retro_audio_sample_t audio_cb = NULL;
-static retro_audio_sample_batch_t audio_batch_cb = NULL;
-static retro_input_poll_t poll_cb = NULL;
-static retro_input_state_t input_state_cb = NULL;
+static void ntsc_table_release(int filter)
+{
+#ifdef S9X_THREAD_INSTANCES
+    std::lock_guard<std::mutex> lock(ntsc_tables_lock);
+#endif
+    if (ntsc_table_users[filter] && !--ntsc_table_users[filter])
+    {
+        delete ntsc_tables[filter];
+        ntsc_tables[filter] = NULL;
+    }
+}
 
-static bool libretro_supports_option_categories = false;
-static bool libretro_supports_bitmasks = false;
+/* Each NTSC output row depends only on its own input row and burst phase,
+   so a frame is blitted as horizontal bands: band 0 on the calling thread,
+   the rest on ntsc_pool's workers, one band each. */
+struct ntsc_band_job
+{
+    const snes_ntsc_t *ntsc;
+    bool hires;
+    const uint16 *in;
+    long in_row_width;
+    int burst_phase;
+    int width, height;
+    uint16 *out;
+    long out_pitch;
+    int bands;
+};
 
-static snes_ntsc_t *snes_ntsc = NULL;
-static int blargg_filter = 0;
-static uint16 *ntsc_screen_buffer, *snes_ntsc_buffer;
+struct ntsc_band_pool;
 
-const int MAX_SNES_WIDTH_NTSC = ((SNES_NTSC_OUT_WIDTH(256) + 3) / 4) * 4;
+static void ntsc_blit_band(const ntsc_band_job &job, int band)
+{
+    int first = job.height * band / job.bands;
+    int count = job.height * (band + 1) / job.bands - first;
+
+    if (count <= 0)
+        return;
+
+    const uint16 *in = job.in + job.in_row_width * first;
+    void *out = (uint8 *) job.out + job.out_pitch * first;
+    int burst_phase = (job.burst_phase + first) % snes_ntsc_burst_count;
+
+    if (job.hires)
+        snes_ntsc_blit_hires(job.ntsc, in, job.in_row_width, burst_phase, job.width, count, out, job.out_pitch);
+    else
+        snes_ntsc_blit(job.ntsc, in, job.in_row_width, burst_phase, job.width, count, out, job.out_pitch);
+}
+
+#ifdef HAVE_THREADS
+/* Each console has a pool of its own. With S9X_THREAD_INSTANCES that makes
+   it thread local, so the workers are handed the pool they serve rather
+   than finding it themselves, and frames reach them as jobs that point at
+   everything they need. */
+struct ntsc_band_pool
+{
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable start, finished;
+    ntsc_band_job job;
+    unsigned generation;
+    int pending;
+    bool quit;
+};
+
+static S9X_TLS_OBJECT ntsc_band_pool ntsc_pool;
+
+/* A worker is handed the generation current when it was created, so a job
+   posted before it first takes the lock is not missed. */
+static void ntsc_worker(ntsc_band_pool *pool, int band, unsigned seen)
+{
+    std::unique_lock<std::mutex> lock(pool->lock);
+
+    while (true)
+    {
+        while (!pool->quit && pool->generation == seen)
+            pool->start.wait(lock);
+
+        if (pool->quit)
+            return;
+
+        seen = pool->generation;
+        ntsc_band_job job = pool->job;
+
+        lock.unlock();
+        ntsc_blit_band(job, band);
+        lock.lock();
+
+        if (--pool->pending == 0)
+            pool->finished.notify_one();
+    }
+}
+
+static void ntsc_pool_stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(ntsc_pool.lock);
+        ntsc_pool.quit = true;
+    }
+    ntsc_pool.start.notify_all();
+
+    for (size_t i = 0; i < ntsc_pool.workers.size(); i++)
+        ntsc_pool.workers[i].join();
 
-static bool show_lightgun_settings = true;
-static bool show_advanced_av_settings = true;
+    ntsc_pool.workers.clear();
+    ntsc_pool.quit = false;
+}
+
+static void ntsc_pool_resize(int threads)
+{
+    if ((int) ntsc_pool.workers.size() == threads - 1)
+        return;
+
+    ntsc_pool_stop();
+
+    for (int band = 1; band < threads; band++)
+        ntsc_pool.workers.push_back(std::thread(ntsc_worker, &ntsc_pool, band, ntsc_pool.generation));
+}
+#endif
+
+static void ntsc_blit_frame(ntsc_band_pool *pool, ntsc_band_job &job)
+{
+#ifdef HAVE_THREADS
+    job.bands = pool ? (int) pool->workers.size() + 1 : 1;
+
+    if (job.bands > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(pool->lock);
+            pool->job = job;
+            pool->pending = job.bands - 1;
+            pool->generation++;
+        }
+        pool->start.notify_all();
+
+        ntsc_blit_band(job, 0);
+
+        std::unique_lock<std::mutex> lock(pool->lock);
+        while (pool->pending)
+            pool->finished.wait(lock);
+        return;
+    }
+#endif
+
+    job.bands = 1;
+    ntsc_blit_band(job, 0);
+}
+
+static S9X_TLS bool show_lightgun_settings = true;
+static S9X_TLS bool show_advanced_av_settings = true;
 /* snes9x_msu1_enhanced_audio core option. The live user preference and the
    value the audio pipeline actually runs on are kept separate: the preference
    is only copied into msu1_enhanced_latched at content load, immediately
@@ -97,8 +323,8 @@ static bool show_advanced_av_settings = true;
    reported sample rate and the rate the core emits at in agreement for the
    whole lifetime of the loaded content, with no need to renegotiate av_info
    from inside a load callback. */
-static bool msu1_enhanced_pref    = true;
-static bool msu1_enhanced_latched = false;
+static S9X_TLS bool msu1_enhanced_pref    = true;
+static S9X_TLS bool msu1_enhanced_latched = false;
 
 static void extract_basename(char *buf, const char *path, size_t size)
 {
@@ -174,26 +400,26 @@ enum aspect_mode {
     ASPECT_RATIO_PAL,
     ASPECT_RATIO_AUTO
 };
-static retro_environment_t environ_cb;
-static overscan_mode crop_overscan_mode = OVERSCAN_CROP_ON; // default to crop
-static aspect_mode aspect_ratio_mode = ASPECT_RATIO_4_3; // default to 4:3
-static bool rom_loaded = false;
+static S9X_TLS retro_environment_t environ_cb;
+static S9X_TLS overscan_mode crop_overscan_mode = OVERSCAN_CROP_ON; // default to crop
+static S9X_TLS aspect_mode aspect_ratio_mode = ASPECT_RATIO_4_3; // default to 4:3
+static S9X_TLS bool rom_loaded = false;
 
 enum lightgun_mode
 {
 	SETTING_GUN_INPUT_LIGHTGUN,
 	SETTING_GUN_INPUT_POINTER
 };
-static lightgun_mode setting_gun_input = SETTING_GUN_INPUT_LIGHTGUN;
+static S9X_TLS lightgun_mode setting_gun_input = SETTING_GUN_INPUT_LIGHTGUN;
 
 // Touchscreen sensitivity vars
-static int pointer_pressed = 0;
+static S9X_TLS int pointer_pressed = 0;
 static const int POINTER_PRESSED_CYCLES = 4;
-static int pointer_cycles_after_released = 0;
-static int pointer_pressed_last_x = 0;
-static int pointer_pressed_last_y = 0;
+static S9X_TLS int pointer_cycles_after_released = 0;
+static S9X_TLS int pointer_pressed_last_x = 0;
+static S9X_TLS int pointer_pressed_last_y = 0;
 
-static bool setting_superscope_reverse_buttons = false;
+static S9X_TLS bool setting_superscope_reverse_buttons = false;
 
 void retro_set_environment(retro_environment_t cb)
 {
@@ -242,6 +468,16 @@ void retro_set_environment(retro_environment_t cb)
 
     cb(RETRO_ENVIRONMENT_SET_SUBSYSTEM_INFO,  (void*)subsystems);
 
+    /* Plain images are asked for by path, so that LoadROM can map the file
+       in place of reading it (see load_game_path). Frontends without the
+       override, and the other extensions, hand over data as before. */
+    static const struct retro_system_content_info_override content_overrides[] = {
+        { "smc|sfc", true, false },
+        { NULL, false, false }
+    };
+
+    cb(RETRO_ENVIRONMENT_SET_CONTENT_INFO_OVERRIDE, (void*)content_overrides);
+
     /* An annoyance: retro_set_environment() can be called
      * multiple times, and depending upon the current frontend
      * state various environment callbacks may be disabled.
@@ -436,6 +672,14 @@ static void update_variables(void)
         TileMode7HiresBilinear = (uint8) Settings.Mode7HiresBilinear;
     }
 
+    var.key = "snes9x_layered_renderer";
+    var.value = NULL;
+
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+        Settings.LayeredRenderer = !strcmp(var.value, "check") ? 2 : !strcmp(var.value, "enabled");
+    else
+        Settings.LayeredRenderer = 0;
+
     var.key = "snes9x_hires_blend";
     var.value = NULL;
 
@@ -448,6 +692,66 @@ static void update_variables(void)
             hires_blend = 2;
     }
 
+    var.key = "snes9x_input_poll";
+    var.value = NULL;
+
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+        input_poll_late = !strcmp(var.value, "late");
+    else
+        input_poll_late = false;
+
+    var.key = "snes9x_runahead";
+    var.value = NULL;
+
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && strcmp(var.value, "disabled"))
+        runahead_frames = atoi(var.value);
+    else
+        runahead_frames = 0;
+
+    var.key = "snes9x_rewind";
+    var.value = NULL;
+
+    unsigned budget = 0;
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && strcmp(var.value, "disabled"))
+        budget = atoi(var.value);
+
+    if (budget != rewind_budget)
+    {
+        rewind_budget = budget;
+        if (!S9xRewindInit(rewind_budget << 20))
+            rewind_budget = 0;
+    }
+
+    var.key = "snes9x_rewind_button";
+    var.value = NULL;
+
+    unsigned button = RETRO_DEVICE_ID_JOYPAD_L2;
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+    {
+        if (!strcmp(var.value, "R2"))
+            button = RETRO_DEVICE_ID_JOYPAD_R2;
+        else if (!strcmp(var.value, "L3"))
+            button = RETRO_DEVICE_ID_JOYPAD_L3;
+        else if (!strcmp(var.value, "R3"))
+            button = RETRO_DEVICE_ID_JOYPAD_R3;
+    }
+
+    if (button != rewind_button)
+    {
+        rewind_button = button;
+        init_descriptors();
+    }
+
+    var.key = "snes9x_log_state_hash";
+    var.value = NULL;
+
+    log_state_hash = environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && !strcmp(var.value, "enabled");
+
+    var.key = "snes9x_rom_info_cache";
+    var.value = NULL;
+
+    Settings.ROMInfoCache = environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && !strcmp(var.value, "enabled");
+
     var.key = "snes9x_overclock_superfx";
     var.value = NULL;
 
@@ -759,15 +1063,13 @@ static void update_variables(void)
 
     if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
     {
+        int old_filter = blargg_filter;
+        snes_ntsc_setup_t setup = snes_ntsc_composite;
+
         if (strcmp(var.value, "disabled") == 0)
             blargg_filter = 0;
         else
         {
-            int old_filter = blargg_filter;
-
-            if(!snes_ntsc) snes_ntsc = new snes_ntsc_t;
-            snes_ntsc_setup_t setup = snes_ntsc_composite;
-
             if (strcmp(var.value, "monochrome") == 0)
             {
                 blargg_filter = 1;
@@ -799,12 +1101,58 @@ static void update_variables(void)
 
                 setup = snes_ntsc_rgb;
             }
+        }
 
-            if (old_filter != blargg_filter)
-                snes_ntsc_init( snes_ntsc, &setup );
+        if (old_filter != blargg_filter)
+        {
+#ifdef HAVE_THREADS
+            /* a posted frame may be filtered with the old table */
+            video_post_drop();
+#endif
+            if (old_filter)
+                ntsc_table_release(old_filter);
+            snes_ntsc = blargg_filter ? ntsc_table_acquire(blargg_filter, &setup) : NULL;
+
+            if (!blargg_filter)
+                video_post_free_ntsc();
         }
     }
 
+#ifdef HAVE_THREADS
+    var.key = "snes9x_blargg_threads";
+    var.value = NULL;
+
+    int ntsc_threads = 1;
+
+    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+    {
+        if (strcmp(var.value, "auto") == 0)
+        {
+            /* a 224-line frame gains little past four bands */
+            ntsc_threads = std::thread::hardware_concurrency();
+            if (ntsc_threads > 4)
+                ntsc_threads = 4;
+        }
+        else
+            ntsc_threads = atoi(var.value);
+    }
+
+    if (ntsc_threads < 1)
+        ntsc_threads = 1;
+
+    video_post_wait();
+    ntsc_pool_resize(blargg_filter ? ntsc_threads : 1);
+#endif
+
+    /* Unchanged frames are reported as dupes, except when the output does
+     * not repeat even though the picture does: the NTSC filter's burst
+     * phase moves every frame, and the hires blend works in place on
+     * GFX.Screen, and a hires frame leaves its left edge pixel as the last
+     * blend left it. Any option change may alter the picture, so the next
+     * frame is always drawn. */
+    Settings.SkipDuplicateFrames = libretro_supports_dupe && !blargg_filter && !hires_blend;
+    IPPU.ScreenDirty = TRUE;
+
     /* Show/hide core options
      * > If frontend supports core option categories,
      *   then show/hide toggle options are ignored,
@@ -906,7 +1254,7 @@ static void update_variables(void)
 /* True while the enhanced upsampler holds valid in-flight state; cleared
    whenever the enhanced path is not the one feeding the frontend, so state
    never leaks across a mode change. */
-static bool msu1_enh_running = false;
+static S9X_TLS bool msu1_enh_running = false;
 
 static bool msu1_enhanced_active(void)
 {
@@ -963,7 +1311,7 @@ static void audio_upload_samples(void)
        so they survive savestates and rollback. */
     if (msu1_enhanced_active())
     {
-        static int16_t enh_buffer[MSU1_ENH_CHUNK * 2];
+        static S9X_TLS int16_t enh_buffer[MSU1_ENH_CHUNK * 2];
 
         int16_t  cur_l = (int16_t) MSU1.MSU1_EnhCurL;
         int16_t  cur_r = (int16_t) MSU1.MSU1_EnhCurR;
@@ -1168,7 +1516,7 @@ void retro_reset()
     S9xSoftReset();
 }
 
-static unsigned snes_devices[8];
+static S9X_TLS unsigned snes_devices[8];
 void retro_set_controller_port_device(unsigned port, unsigned device)
 {
     reset_button_cache();
@@ -1286,6 +1634,7 @@ static void init_descriptors(void)
         { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R,		"R" },
         { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT,	"Select" },
         { 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_START,		"Start" },
+        { 0, RETRO_DEVICE_JOYPAD, 0, rewind_button,			"Rewind" },
     
         { 1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_LEFT,  "D-Pad Left" },
         { 1, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_UP,		"D-Pad Up" },
@@ -1464,6 +1813,101 @@ static bool8 is_SufamiTurbo_Cart (const uint8 *data, uint32 size)
         return (FALSE);
 }
 
+/* Carts that go in behind a BIOS: size is the image's, and the first
+   available bytes of it are at data. */
+static bool is_bios_cart (const uint8 *data, size_t size, size_t available)
+{
+    return ((available >= 0x20 && is_SufamiTurbo_Cart(data, size)) ||
+            is_bsx_at(data, available, 0x7fc0) == 1 || is_bsx_at(data, available, 0xffc0) == 1);
+}
+
+/* Data the frontend read from path can be keyed in the ROM info cache by
+   that file (LoadROMMem's imagePath) when it is the file as it stands: the
+   same size, and no patch beside it for the frontend to have applied. */
+static const char *data_image_path (const char *path, size_t size)
+{
+    static const char *const patches[] = { ".ips", ".ups", ".bps" };
+
+    if (!path || !Settings.ROMInfoCache || path_get_size(path) != (int64_t) size)
+        return NULL;
+
+    std::string base = path;
+    size_t dot = base.find_last_of('.');
+    size_t slash = base.find_last_of("/\\");
+    if (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+        base.erase(dot);
+
+    for (const char *patch : patches)
+        if (path_is_valid((base + patch).c_str()))
+            return NULL;
+
+    return path;
+}
+
+static bool load_game_data (const uint8 *data, size_t size, const char *path)
+{
+    uint8 *biosrom = new uint8[0x100000];
+    bool loaded;
+
+    if (is_SufamiTurbo_Cart(data, size)) {
+        if ((loaded = LoadBIOS(biosrom,"STBIOS.bin",0x40000)))
+        loaded = Memory.LoadMultiCartMem(data, size, 0, 0, biosrom, 0x40000);
+    }
+
+    else
+    if (is_bsx_at(data, size, 0x7fc0) == 1 ||
+        is_bsx_at(data, size, 0xffc0) == 1) {
+        if ((loaded = LoadBIOS(biosrom,"BS-X.bin",0x100000)))
+        loaded = Memory.LoadMultiCartMem(biosrom, 0x100000, data, size, 0, 0);
+    }
+
+    else
+        loaded = Memory.LoadROMMem(data, size, g_basename, data_image_path(path, size));
+
+    delete[] biosrom;
+
+    return loaded;
+}
+
+/* Content handed over by path. A plain image goes to LoadROM, which maps
+   the file where it can. BS-X and Sufami Turbo carts are told apart on the
+   image - mapped, or the head of the file when it cannot be - and are read
+   whole and loaded like data. */
+static bool load_game_path (const char *path)
+{
+    uint32 size = Memory.MapROMFile(path);
+    bool bios_cart;
+
+    if (size)
+        bios_cart = is_bios_cart(Memory.ROM, size, size);
+    else
+    {
+        RFILE *file = filestream_open(path, RETRO_VFS_FILE_ACCESS_READ, RETRO_VFS_FILE_ACCESS_HINT_NONE);
+        if (!file)
+            return false;
+
+        std::vector<uint8> head(0x10000);
+        int64_t length = filestream_get_size(file);
+        int64_t got = filestream_read(file, head.data(), head.size());
+        filestream_close(file);
+
+        bios_cart = length > 0 && got > 0 && is_bios_cart(head.data(), (size_t) length, (size_t) got);
+    }
+
+    if (!bios_cart)
+        return Memory.LoadROM(path);
+
+    void *data = NULL;
+    int64_t length = 0;
+    if (!filestream_read_file(path, &data, &length))
+        return false;
+
+    bool loaded = load_game_data((const uint8 *) data, (size_t) length, path);
+    free(data);
+
+    return loaded;
+}
+
 /* MSU-1 tracks are 44.1 kHz PCM. Mixing them into the SPC's ~32040 Hz stream
    decimates them through an interpolator with no anti-alias filtering, which
    folds 16.02-22.05 kHz track content down into the 10-16 kHz band as audible
@@ -1486,40 +1930,23 @@ static void msu1_latch_playback_rate(void)
 
 bool retro_load_game(const struct retro_game_info *game)
 {
+    std::chrono::steady_clock::time_point load_start = std::chrono::steady_clock::now();
+
     init_descriptors();
 
     update_variables();
 
-    if(game->data == NULL && game->size == 0 && game->path != NULL)
-        rom_loaded = Memory.LoadROM(game->path);
-    else
+    if (game->path != NULL)
     {
-        uint8 *biosrom = new uint8[0x100000];
-
-        if (game->path != NULL)
-        {
-            extract_basename(g_basename, game->path, sizeof(g_basename));
-            extract_directory(g_rom_dir, game->path, sizeof(g_rom_dir));
-        }
-
-        if (is_SufamiTurbo_Cart((uint8 *) game->data, game->size)) {
-            if ((rom_loaded = LoadBIOS(biosrom,"STBIOS.bin",0x40000)))
-            rom_loaded = Memory.LoadMultiCartMem((const uint8_t*)game->data, game->size, 0, 0, biosrom, 0x40000);
-        }
-
-        else
-        if (is_bsx_at((const uint8 *) game->data, game->size, 0x7fc0) == 1 ||
-            is_bsx_at((const uint8 *) game->data, game->size, 0xffc0) == 1) {
-            if ((rom_loaded = LoadBIOS(biosrom,"BS-X.bin",0x100000)))
-            rom_loaded = Memory.LoadMultiCartMem(biosrom, 0x100000, (const uint8_t*)game->data, game->size, 0, 0);
-        }
-
-        else
-            rom_loaded = Memory.LoadROMMem((const uint8_t*)game->data ,game->size, g_basename);
-
-        if(biosrom) delete[] biosrom;
+        extract_basename(g_basename, game->path, sizeof(g_basename));
+        extract_directory(g_rom_dir, game->path, sizeof(g_rom_dir));
     }
 
+    if(game->data == NULL && game->size == 0 && game->path != NULL)
+        rom_loaded = load_game_path(game->path);
+    else
+        rom_loaded = load_game_data((const uint8 *) game->data, game->size, game->path);
+
     if (rom_loaded)
     {
         /* If we're in RGB565 format, switch frontend to that */
@@ -1537,7 +1964,7 @@ bool retro_load_game(const struct retro_game_info *game)
         if (randomize_memory)
         {
             srand(time(NULL));
-            for(size_t lcv = 0; lcv < sizeof(Memory.RAM); lcv++)
+            for(size_t lcv = 0; lcv < sizeof(SArena::RAM); lcv++)
                 Memory.RAM[lcv] = rand() % 256;
         }
     }
@@ -1549,6 +1976,11 @@ bool retro_load_game(const struct retro_game_info *game)
 
     Memory.ClearSRAM();
 
+    // Cold-load time, ROM image to ready to run, for benchmark runs to pick up.
+    if (rom_loaded && log_cb)
+        log_cb(RETRO_LOG_INFO, "ROM loaded in %.2f ms\n",
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_start).count());
+
     return rom_loaded;
 }
 
@@ -1687,7 +2119,13 @@ bool retro_load_game_special(unsigned game_type, const struct retro_game_info *i
 }
 
 void retro_unload_game(void)
-{}
+{
+    free(runahead_state);
+    runahead_state = NULL;
+    runahead_state_size = 0;
+
+    S9xRewindReset();
+}
 
 static void map_buttons();
 
@@ -1768,8 +2206,6 @@ void retro_init(void)
     S9xSetSoundMute(FALSE);
     S9xSetSamplesAvailableCallback(NULL, NULL);
 
-    ntsc_screen_buffer = (uint16*) calloc(1, MAX_SNES_WIDTH_NTSC * 2 * (MAX_SNES_HEIGHT + 16));
-    snes_ntsc_buffer = ntsc_screen_buffer + (MAX_SNES_WIDTH_NTSC >> 1) * 16;
     S9xGraphicsInit();
 
     S9xInitInputDevices();
@@ -1785,6 +2221,14 @@ void retro_init(void)
 	
     if (environ_cb(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL))
         libretro_supports_bitmasks = true;
+
+    bool can_dupe = false;
+    if (environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &can_dupe))
+        libretro_supports_dupe = can_dupe;
+
+#ifdef HAVE_THREADS
+    video_post_start();
+#endif
 }
 
 #define MAP_BUTTON(id, name) S9xMapButton((id), S9xGetCommandT((name)))
@@ -1802,7 +2246,7 @@ void retro_init(void)
    dropped whenever the core's own copy can change underneath it:
    savestate load restores the peripheral button state, and a device
    change or reset rebuilds it. */
-static uint8 peripheral_button_cache[MAKE_BUTTON(3 + 1, 0)];
+static S9X_TLS uint8 peripheral_button_cache[MAKE_BUTTON(3 + 1, 0)];
 
 static void reset_button_cache(void)
 {
@@ -1923,8 +2367,8 @@ static void map_buttons()
     S9xMapPointer((BTN_POINTER2), S9xGetCommandT("Pointer Mouse2+Justifier2"));
 }
 
-static int16_t snes_mouse_state[2][2] = {{0}, {0}};
-static bool snes_superscope_turbo_latch = false;
+static S9X_TLS int16_t snes_mouse_state[2][2] = {{0}, {0}};
+static S9X_TLS bool snes_superscope_turbo_latch = false;
 
 static void input_report_gun_position( unsigned port, int s9xinput )
 {
@@ -2246,9 +2690,71 @@ static void report_buttons()
     }
 }
 
+static void poll_input(void)
+{
+    poll_cb();
+    report_buttons();
+    if (rewind_budget)
+        rewind_held = input_state_cb(0, RETRO_DEVICE_JOYPAD, 0, rewind_button);
+    input_poll_pending = false;
+}
+
+void S9xOnSNESPadLatch(void)
+{
+    if (input_poll_pending)
+        poll_input();
+}
+
+/* Core-side runahead. The frame retro_run just emulated, undrawn, is the real
+   one; its audio has been uploaded. Snapshot it, emulate runahead_frames more
+   with the same input - drawing only the last, whose picture is what the
+   frontend gets - and roll back. The hidden frames keep the DSP running, as
+   the game can read voice state back and echo writes land in ARAM, but their
+   samples are dropped. The snapshot never leaves this process, so it is a raw
+   one. */
+static void run_ahead(void)
+{
+    static S9X_TLS struct SDirtyPages dirty;
+
+    if (!runahead_state)
+    {
+        runahead_state_size = S9xFreezeRawSize();
+        runahead_state = (uint8 *) malloc(runahead_state_size);
+        if (!runahead_state)
+            return;
+    }
+
+    bool8 fast = Settings.FastSavestates;
+    Settings.FastSavestates = TRUE;
+    if (!S9xFreezeRaw(runahead_state, runahead_state_size))
+    {
+        Settings.FastSavestates = fast;
+        return;
+    }
+    dirty = Dirty;
+
+    for (unsigned i = 1; i <= runahead_frames; i++)
+    {
+        IPPU.RenderThisFrame = (i == runahead_frames);
+        S9xMainLoop();
+    }
+
+    S9xUnfreezeRaw(runahead_state, runahead_state_size);
+    Settings.FastSavestates = fast;
+    S9xClearSamples();
+
+    // Memory is back exactly as it was snapshotted, so the page stamps from
+    // then still hold; the load marking every page changed would cost the
+    // next rewind delta a full-size pass.
+    Dirty = dirty;
+
+    if (disabled_channels)
+        S9xSetSoundControl(disabled_channels^0xFF);
+}
+
 void retro_run()
 {
-    static uint16 height = PPU.ScreenHeight;
+    static S9X_TLS uint16 height = PPU.ScreenHeight;
     bool updated = false;
     if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE_UPDATE, &updated) && updated)
         update_variables();
@@ -2292,25 +2798,97 @@ void retro_run()
         Settings.HardDisableAudio = FALSE;
     }
 
-    poll_cb();
-    report_buttons();
+    video_wanted = IPPU.RenderThisFrame;
+
+    // Frames the frontend replays or discards are its own business: leave
+    // rewind and runahead to it while it runs them.
+    bool replaying = !IPPU.RenderThisFrame || Settings.HardDisableAudio;
+
+    if (!input_poll_late)
+        poll_input();
+
+    // Rewinding: load the state from one frame further back and replay the
+    // frame after it, drawn but not heard. The button is the one poll_input
+    // read: this run's, or with the late poll, the last run's.
+    bool rewinding = rewind_budget && !replaying && rewind_held && S9xRewindStep();
+    if (rewinding)
+    {
+        // The load brought back the buttons of the frame it went to.
+        reset_button_cache();
+        if (!input_poll_late)
+            report_buttons();
+        if (disabled_channels)
+            S9xSetSoundControl(disabled_channels^0xFF);
+    }
+
+    if (input_poll_late)
+        input_poll_pending = true;
+
+    bool ahead = runahead_frames && !replaying && !rewinding;
+    if (ahead)
+        IPPU.RenderThisFrame = FALSE;
+
+    frame_presented = false;
     S9xMainLoop();
 
-    audio_upload_samples();
+    // The game never latched its controllers; the frontend still expects
+    // its poll.
+    if (input_poll_pending)
+        poll_input();
+
+    if (rewinding)
+        S9xClearSamples();
+    else
+    {
+        audio_upload_samples();
+        if (!replaying)
+            S9xRewindPush();
+    }
+
+    if (ahead)
+        run_ahead();
+
+    // The frontend's framebuffer is only good for this run.
+    S9xReleaseScreenTarget();
+
+    if (log_state_hash && log_cb)
+        log_cb(RETRO_LOG_INFO, "frame %u state %016llx\n", IPPU.TotalEmulatedFrames, (unsigned long long) S9xStateHash());
+
+    video_post_finish();
+
+    // No frame was handed over this run: tell the frontend to show the
+    // previous one again rather than leaving it to guess.
+    if (!frame_presented && libretro_supports_dupe)
+        video_cb(NULL, last_video_width, last_video_height, last_video_pitch);
 }
 
 void retro_deinit()
 {
+    S9xRewindDeinit();
+    rewind_budget = 0;
+    rewind_held = false;
+
     S9xDeinitAPU();
     Memory.Deinit();
     S9xGraphicsDeinit();
     S9xUnmapAllControls();
 
+#ifdef HAVE_THREADS
+    video_post_stop();
+    ntsc_pool_stop();
+#endif
+
+    if (blargg_filter)
+        ntsc_table_release(blargg_filter);
+    snes_ntsc = NULL;
+    blargg_filter = 0;
+
     free(screen_buffer);
-    free(ntsc_screen_buffer);
+    video_post_free_ntsc();
 
     libretro_supports_option_categories = false;
     libretro_supports_bitmasks = false;
+    libretro_supports_dupe = false;
 }
 
 
@@ -2337,9 +2915,11 @@ void* retro_get_memory_data(unsigned type)
             break;
         case RETRO_MEMORY_SYSTEM_RAM:
             data = Memory.RAM;
+            S9xDirtyUnhooked(Memory.RAM);
             break;
         case RETRO_MEMORY_VIDEO_RAM:
             data = Memory.VRAM;
+            S9xDirtyUnhooked(Memory.VRAM);
             break;
         case RETRO_MEMORY_ROM:
             data = Memory.ROM;
@@ -2414,28 +2994,71 @@ static bool savestate_wants_fast_path(void)
     return false;
 }
 
+/* A state the frontend keeps in this address space - runahead, rewind - may
+   be a raw one: the emulator's memory copied as it lies, pointers and all.
+   Only the frontend can say so, through the savestate context. */
+static bool savestate_is_same_instance(void)
+{
+    enum retro_savestate_context context = RETRO_SAVESTATE_CONTEXT_NORMAL;
+
+    return environ_cb(RETRO_ENVIRONMENT_GET_SAVESTATE_CONTEXT, &context) &&
+           context == RETRO_SAVESTATE_CONTEXT_RUNAHEAD_SAME_INSTANCE;
+}
+
 size_t retro_serialize_size()
 {
-    return rom_loaded ? S9xFreezeSize() : 0;
+    if (!rom_loaded)
+        return 0;
+
+    uint32 size = S9xFreezeSize();
+
+    /* retro_serialize falls back to a portable state if the raw one fails,
+       so the size has to hold either. */
+    if (savestate_is_same_instance())
+    {
+        uint32 raw = S9xFreezeRawSize();
+        if (raw > size)
+            size = raw;
+    }
+
+    return size;
 }
 
 bool retro_serialize(void *data, size_t size)
 {
     Settings.FastSavestates = savestate_wants_fast_path();
 
+    if (savestate_is_same_instance() && S9xFreezeRaw((uint8_t*)data,size))
+        return true;
+
     if (S9xFreezeGameMem((uint8_t*)data,size) == FALSE)
         return false;
 
     return true;
 }
 
+/* Not part of the libretro API; look it up by name. A fingerprint of the
+   whole emulated state, cheap enough to take every frame, for netplay desync
+   checks and regression runs. Two runs agree exactly when their hashes do,
+   on one build of the core. */
+extern "C" RETRO_API uint64_t snes9x_state_hash(void)
+{
+    if (!rom_loaded)
+        return 0;
+
+    return S9xStateHash();
+}
+
 bool retro_unserialize(const void* data, size_t size)
 {
     reset_button_cache();
 
     Settings.FastSavestates = savestate_wants_fast_path();
 
-    if (S9xUnfreezeGameMem((const uint8_t*)data,size) != SUCCESS)
+    int result = S9xUnfreezeRaw((const uint8_t*)data,size);
+    if (result == WRONG_FORMAT)
+        result = S9xUnfreezeGameMem((const uint8_t*)data,size);
+    if (result != SUCCESS)
         return false;
 
     // restore disabled sound channels
@@ -2447,77 +3070,147 @@ bool retro_unserialize(const void* data, size_t size)
     return true;
 }
 
-bool8 S9xDeinitUpdate(int width, int height)
+/* A frame between the PPU and the frontend, with the options it is
+   post-processed under. width and height start as the rendered size and end
+   as the presented one. */
+struct video_post_job
 {
-    static int burst_phase = 0;
-    int overscan_offset = 0;
+    uint16 *screen;          /* laid out like GFX.Screen, rows ppl apart */
+    unsigned ppl;
+    int width, height;
+    int m7_start;            /* IPPU.M7VertStartY */
+    overscan_mode crop;
+    int hires_blend;
+    const snes_ntsc_t *ntsc; /* NULL: no NTSC filter */
+    ntsc_band_pool *ntsc_pool; /* the console's band workers, or NULL */
+    int burst_phase;
+    uint16 *ntsc_out;
+    SCrosshairs crosshairs;
+    const uint16 *data;
+    size_t pitch;
+};
 
-    if (crop_overscan_mode == OVERSCAN_CROP_ON)
+/* The NTSC filter's output exists only while the filter is on; it has 16
+   rows of black above it for overscan to crop into. */
+static S9X_TLS uint16 *ntsc_buffer = NULL, *ntsc_screen = NULL;
+
+static void video_post_free_ntsc()
+{
+    free(ntsc_buffer);
+    ntsc_buffer = ntsc_screen = NULL;
+}
+
+static bool video_post_alloc_ntsc()
+{
+    if (!ntsc_buffer)
+    {
+        ntsc_buffer = (uint16 *) calloc(1, MAX_SNES_WIDTH_NTSC * 2 * (MAX_SNES_HEIGHT + 16));
+        if (!ntsc_buffer)
+            return false;
+        ntsc_screen = ntsc_buffer + (MAX_SNES_WIDTH_NTSC >> 1) * 16;
+    }
+
+    return true;
+}
+
+/* Hand a finished frame to the frontend, remembering its geometry for the
+   dupe retro_run reports when no frame is produced. */
+static void present_frame(const uint16 *data, unsigned width, unsigned height, size_t pitch)
+{
+    video_cb(data, width, height, pitch);
+
+    frame_presented = true;
+    last_video_width = width;
+    last_video_height = height;
+    last_video_pitch = pitch;
+}
+
+/* The rows of a frame height rows tall that crop presents: returns how many,
+   and sets offset to how far down the frame they start. More rows than the
+   frame has are padded with black: -offset of them above, the rest below. */
+static int overscan_rows(overscan_mode crop, int height, int *offset)
+{
+    *offset = 0;
+
+    if (crop == OVERSCAN_CROP_ON)
     {
         if (height > SNES_HEIGHT * 2)
         {
-            overscan_offset = 14;
+            *offset = 14;
             height = SNES_HEIGHT * 2;
         }
         else if ((height > SNES_HEIGHT) && (height != SNES_HEIGHT * 2))
         {
-            overscan_offset = 7;
+            *offset = 7;
             height = SNES_HEIGHT;
         }
     }
-    else if (crop_overscan_mode == OVERSCAN_CROP_12)
+    else if (crop == OVERSCAN_CROP_12)
     {
         if (height > 216 * 2)
         {
-            overscan_offset = 8;
+            *offset = 8;
             height = 216 * 2;
         }
         else if ((height > 216) && (height != 216 * 2))
         {
-            overscan_offset = 4;
+            *offset = 4;
             height = 216;
         }
     }
-    else if (crop_overscan_mode == OVERSCAN_CROP_16)
+    else if (crop == OVERSCAN_CROP_16)
     {
         if (height > 208 * 2)
         {
-            overscan_offset = 16;
+            *offset = 16;
             height = 208 * 2;
         }
         else if ((height > 208) && (height != 208 * 2))
         {
-            overscan_offset = 8;
+            *offset = 8;
             height = 208;
         }
     }
-    else if (crop_overscan_mode == OVERSCAN_CROP_OFF)
+    else if (crop == OVERSCAN_CROP_OFF)
     {
         if (height > SNES_HEIGHT_EXTENDED)
         {
             if (height < SNES_HEIGHT_EXTENDED * 2)
-            {
-                overscan_offset = -16;
-                memset(GFX.Screen + (GFX.Pitch >> 1) * height,0,GFX.Pitch * ((SNES_HEIGHT_EXTENDED << 1) - height));
-            }
+                *offset = -16;
             height = SNES_HEIGHT_EXTENDED * 2;
         }
         else
         {
             if (height < SNES_HEIGHT_EXTENDED)
-            {
-                overscan_offset = -8;
-                memset(GFX.Screen + (GFX.Pitch >> 1) * height,0,GFX.Pitch * (SNES_HEIGHT_EXTENDED - height));
-            }
+                *offset = -8;
             height = SNES_HEIGHT_EXTENDED;
         }
     }
 
+    return height;
+}
 
-    if (blargg_filter)
-    {
-        burst_phase = (burst_phase + 1) % 3;
+/* Everything between the PPU finishing a frame and present_frame(): the
+   Mode 7 vertical resample, the crosshairs, overscan cropping, and the NTSC
+   filter or the hires blend. Works in job.screen and touches nothing else of the core's,
+   so it can run beside the emulation. Leaves the rows to present in
+   job.data. */
+static void post_process_frame(video_post_job &job)
+{
+    int width = job.width;
+    int height = S9xMode7VertResample(job.screen, job.ppl, job.width, job.height, job.m7_start);
+    int overscan_offset;
+
+    S9xDrawCrosshairs(job.screen, job.ppl, job.width, height, &job.crosshairs);
+
+    int presented = overscan_rows(job.crop, height, &overscan_offset);
+
+    if (presented > height)
+        memset(job.screen + job.ppl * height, 0, job.ppl * sizeof(uint16) * (presented - height));
+    height = presented;
 
+    if (job.ntsc)
+    {
         if (width > 512)
         {
             /* HD Mode 7 4x frame. The NTSC filter models a composite
@@ -2533,7 +3226,7 @@ bool8 S9xDeinitUpdate(int width, int height)
                2x/2x+1 stay ahead of the write at x. */
             for (int y = 0; y < height; y++)
             {
-                uint16 *row = GFX.Screen + (size_t) y * (GFX.Pitch >> 1);
+                uint16 *row = job.screen + (size_t) y * job.ppl;
                 for (int x = 0; x < 512; x++)
                 {
                     uint16 a = row[2 * x], b = row[2 * x + 1];
@@ -2543,23 +3236,32 @@ bool8 S9xDeinitUpdate(int width, int height)
             width = 512;
         }
 
-        if (width == 512)
-            snes_ntsc_blit_hires(snes_ntsc, GFX.Screen, GFX.Pitch / 2, burst_phase, width, height, snes_ntsc_buffer, MAX_SNES_WIDTH_NTSC * 2);
-        else
-            snes_ntsc_blit(snes_ntsc, GFX.Screen, GFX.Pitch / 2, burst_phase, width, height, snes_ntsc_buffer, MAX_SNES_WIDTH_NTSC * 2);
+        ntsc_band_job ntsc;
+        ntsc.hires = (width == 512);
+        ntsc.ntsc = job.ntsc;
+        ntsc.in = job.screen;
+        ntsc.in_row_width = job.ppl;
+        ntsc.burst_phase = job.burst_phase;
+        ntsc.width = width;
+        ntsc.height = height;
+        ntsc.out = job.ntsc_out;
+        ntsc.out_pitch = MAX_SNES_WIDTH_NTSC * 2;
+        ntsc_blit_frame(job.ntsc_pool, ntsc);
 
-        video_cb(snes_ntsc_buffer + ((int)(MAX_SNES_WIDTH_NTSC) * overscan_offset), SNES_NTSC_OUT_WIDTH(256), height, MAX_SNES_WIDTH_NTSC * 2);
+        job.data = job.ntsc_out + ((int)(MAX_SNES_WIDTH_NTSC) * overscan_offset);
+        job.width = SNES_NTSC_OUT_WIDTH(256);
+        job.pitch = MAX_SNES_WIDTH_NTSC * 2;
     }
-    else if (width == MAX_SNES_WIDTH && hires_blend)
+    else if (width == MAX_SNES_WIDTH && job.hires_blend)
     {
         #define AVERAGE_565(el0, el1) (((el0) & (el1)) + ((((el0) ^ (el1)) & 0xF7DE) >> 1))
 
-        if (hires_blend == 1) /* Blur method */
+        if (job.hires_blend == 1) /* Blur method */
         {
             for (int y = 0; y < height; y++)
             {
-                uint16 *input = (uint16 *) ((uint8 *) GFX.Screen + y * GFX.Pitch);
-                uint16 *output = (uint16 *) ((uint8 *) GFX.Screen + y * GFX.Pitch);
+                uint16 *input = job.screen + y * job.ppl;
+                uint16 *output = job.screen + y * job.ppl;
                 uint16 l, r;
 
                 l = 0;
@@ -2575,12 +3277,12 @@ bool8 S9xDeinitUpdate(int width, int height)
                 }
             }
         }
-        else if (hires_blend == 2) /* Merge method */
+        else if (job.hires_blend == 2) /* Merge method */
         {
             for (int y = 0; y < height; y++)
             {
-                uint16 *input = (uint16 *) ((uint8 *) GFX.Screen + y * GFX.Pitch);
-                uint16 *output = (uint16 *) ((uint8 *) GFX.Screen + y * GFX.Pitch);
+                uint16 *input = job.screen + y * job.ppl;
+                uint16 *output = job.screen + y * job.ppl;
                 uint16 l, r;
 
                 for (int x = 0; x < (width >> 1); x++)
@@ -2594,12 +3296,177 @@ bool8 S9xDeinitUpdate(int width, int height)
             width >>= 1;
         }
 
-        video_cb(GFX.Screen + ((int)(GFX.Pitch >> 1) * overscan_offset), width, height, GFX.Pitch);
+        job.data = job.screen + ((int) job.ppl * overscan_offset);
+        job.width = width;
+        job.pitch = job.ppl * sizeof(uint16);
     }
     else
     {
-        video_cb(GFX.Screen + ((int)(GFX.Pitch >> 1) * overscan_offset), width, height, GFX.Pitch);
+        job.data = job.screen + ((int) job.ppl * overscan_offset);
+        job.width = width;
+        job.pitch = job.ppl * sizeof(uint16);
+    }
+
+    job.height = height;
+}
+
+#ifdef HAVE_THREADS
+/* A drawn frame is presented at the end of the retro_run that drew it. What
+   retro_run still has to do after the frame is drawn - the rewind push, and
+   with run-ahead the state restore - takes long enough to post-process the
+   frame beside, so with either on, drawn frames go to video_post's worker,
+   which works on GFX.Screen in place while the emulation thread finishes
+   the run. Nothing draws into GFX.Screen again before the next run, and
+   video_post_finish waits for the worker before the run returns. Without
+   them there is nothing to overlap but the audio upload, and the frame is
+   post-processed inline. The worker sees only its job, and update_variables
+   waits for it before changing what a job points at. Like ntsc_pool, there
+   is one per console, and its worker is handed it. */
+struct video_post_state
+{
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable start, finished;
+    video_post_job job;
+    bool pending; /* posted and not presented yet */
+    bool busy;    /* worker has not finished it */
+    bool quit;
+};
+
+static S9X_TLS_OBJECT video_post_state video_post;
+
+static void video_post_worker(video_post_state *post)
+{
+    std::unique_lock<std::mutex> lock(post->lock);
+
+    while (true)
+    {
+        while (!post->quit && !post->busy)
+            post->start.wait(lock);
+
+        if (post->quit)
+            return;
+
+        lock.unlock();
+        post_process_frame(post->job);
+        lock.lock();
+
+        post->busy = false;
+        post->finished.notify_one();
+    }
+}
+
+static void video_post_wait()
+{
+    std::unique_lock<std::mutex> lock(video_post.lock);
+
+    while (video_post.busy)
+        video_post.finished.wait(lock);
+}
+
+/* Forget the posted frame, when the buffers it was made in go away. */
+static void video_post_drop()
+{
+    video_post_wait();
+    video_post.pending = false;
+}
+
+static bool video_post_pipelined()
+{
+    return video_post.worker.joinable() && (rewind_budget || runahead_frames) &&
+           (blargg_filter || hires_blend || (Settings.Mode7Hires && Settings.Mode7HiresVertical));
+}
+
+/* A single core gains nothing from the hand-off but the latency. */
+static void video_post_start()
+{
+    if (std::thread::hardware_concurrency() > 1)
+        video_post.worker = std::thread(video_post_worker, &video_post);
+}
+
+static void video_post_stop()
+{
+    video_post_drop();
+
+    {
+        std::lock_guard<std::mutex> lock(video_post.lock);
+        video_post.quit = true;
     }
+    video_post.start.notify_one();
+
+    if (video_post.worker.joinable())
+        video_post.worker.join();
+
+    video_post.quit = false;
+}
+#endif
+
+/* End of a run, or a second frame drawn in it: wait for the worker, and
+   present the frame it was given unless the run has presented one already
+   or the frontend asked for no video. */
+static void video_post_finish()
+{
+#ifdef HAVE_THREADS
+    video_post_wait();
+
+    if (video_post.pending && !frame_presented && video_wanted)
+        present_frame(video_post.job.data, video_post.job.width, video_post.job.height, video_post.job.pitch);
+    video_post.pending = false;
+#endif
+}
+
+bool8 S9xDeinitUpdate(int width, int height)
+{
+    static S9X_TLS int burst_phase = 0;
+    video_post_job job;
+
+    if (blargg_filter)
+        burst_phase = (burst_phase + 1) % 3;
+
+    job.width = width;
+    job.height = height;
+    job.m7_start = IPPU.M7VertStartY;
+    job.crop = crop_overscan_mode;
+    job.hires_blend = hires_blend;
+    job.ntsc = snes_ntsc;
+#ifdef HAVE_THREADS
+    job.ntsc_pool = &ntsc_pool;
+#else
+    job.ntsc_pool = NULL;
+#endif
+    job.burst_phase = burst_phase;
+    job.crosshairs = *S9xFrameCrosshairs();
+    job.screen = GFX.Screen;
+    job.ppl = GFX.RealPPL;
+    job.ntsc_out = NULL;
+    if (job.ntsc)
+    {
+        if (video_post_alloc_ntsc())
+            job.ntsc_out = ntsc_screen;
+        else
+            job.ntsc = NULL;
+    }
+
+    /* A frame posted earlier in this run is older than this one, and in the
+       same buffers: it is presented first. */
+    video_post_finish();
+
+#ifdef HAVE_THREADS
+    if (video_post_pipelined())
+    {
+        {
+            std::lock_guard<std::mutex> lock(video_post.lock);
+            video_post.job = job;
+            video_post.pending = true;
+            video_post.busy = true;
+        }
+        video_post.start.notify_one();
+        return TRUE;
+    }
+#endif
+
+    post_process_frame(job);
+    present_frame(job.data, job.width, job.height, job.pitch);
 
     return TRUE;
 }
@@ -2610,6 +3477,34 @@ bool8 S9xContinueUpdate(int width, int height)
     return true;
 }
 
+/* A frame is starting. One that reaches the frontend as drawn - low-res, not
+   interlaced, no post-processing, and no overscan rows cropped or added - is
+   drawn straight into the frontend's framebuffer when it offers one in our
+   format, which saves the frontend copying it out of GFX.Screen. If the
+   frame turns hires or interlaced partway down, the renderer moves it back
+   into GFX.Screen and the framebuffer goes unused. */
+bool8 S9xInitUpdate()
+{
+    struct retro_framebuffer fb;
+    int offset;
+
+    if (blargg_filter || hires_blend || (Settings.Mode7Hires && Settings.Mode7HiresVertical) ||
+        IPPU.RenderedScreenWidth != SNES_WIDTH || IPPU.DoubleHeightPixels || GFX.DoInterlace ||
+        overscan_rows(crop_overscan_mode, IPPU.RenderedScreenHeight, &offset) != IPPU.RenderedScreenHeight || offset)
+        return TRUE;
+
+    memset(&fb, 0, sizeof(fb));
+    fb.width        = IPPU.RenderedScreenWidth;
+    fb.height       = IPPU.RenderedScreenHeight;
+    fb.access_flags = RETRO_MEMORY_ACCESS_WRITE | RETRO_MEMORY_ACCESS_READ;
+
+    if (environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &fb) && fb.data &&
+        fb.format == RETRO_PIXEL_FORMAT_RGB565 && !(fb.pitch % sizeof(uint16)))
+        S9xSetScreenTarget((uint16 *) fb.data, fb.pitch / sizeof(uint16));
+
+    return TRUE;
+}
+
 // Dummy functions that should probably be implemented correctly later.
 const char* S9xStringInput(const char* in) { return in; }
 
@@ -2625,6 +3520,8 @@ std::string S9xGetDirectory(s9x_getdirtype type)
     {
         case BIOS_DIR:
             return std::string(retro_system_directory);
+        case CACHE_DIR:
+            return std::string(retro_save_directory);
         default:
             return std::string(g_rom_dir);
     }
@@ -2633,7 +3530,6 @@ std::string S9xGetDirectory(s9x_getdirtype type)
 }
 void S9xInitInputDevices() {}
 const char* S9xBasename(const char* in) { return in; }
-bool8 S9xInitUpdate() { return TRUE; }
 
 void S9xMessage(int type, int, const char* s)
 {
@@ -156,6 +156,21 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "snes9x_layered_renderer",
+      "Two-Phase Renderer",
+      NULL,
+      "Draw lines in modes 0-4 without hi-res, interlace or mosaic into native-width buffers, and apply color math in a separate compositing pass at the frame's final width. Priority and windows are still resolved while drawing; every other line takes the normal path. Games that switch into hi-res partway down the screen no longer pay for re-widening lines already drawn. 'Check' also draws those lines the normal way and logs a warning for each frame where the two differ (slow).",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { "check",    "Check" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "snes9x_hires_blend",
       "Hi-Res Blending",
@@ -189,6 +204,27 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+#ifdef HAVE_THREADS
+   {
+      "snes9x_blargg_threads",
+      "Blargg NTSC Filter Threads",
+      NULL,
+      "Number of threads the NTSC filter splits each frame across. 'Auto' uses up to 4, depending on the number of CPU cores. Has no effect on the output image.",
+      NULL,
+      NULL,
+      {
+         { "auto", "Auto" },
+         { "1",    NULL },
+         { "2",    NULL },
+         { "3",    NULL },
+         { "4",    NULL },
+         { "6",    NULL },
+         { "8",    NULL },
+         { NULL, NULL },
+      },
+      "auto"
+   },
+#endif
    {
       "snes9x_audio_interpolation",
       "Audio Interpolation",
@@ -332,6 +368,98 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "snes9x_input_poll",
+      "Input Polling",
+      NULL,
+      "'Late' reads the controllers when the game latches them instead of before the frame starts, which can shave input latency for games that read their pads late in the frame.",
+      NULL,
+      NULL,
+      {
+         { "early", "Early" },
+         { "late",  "Late" },
+         { NULL, NULL },
+      },
+      "early"
+   },
+   {
+      "snes9x_runahead",
+      "Run-Ahead Frames",
+      NULL,
+      "Show the frame that many frames ahead of the emulated one, hiding the game's own input lag. The core snapshots and replays only what changes and skips drawing and audio of the hidden frames, so this costs less than the frontend's run-ahead. Too high a value makes input jittery.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "1",        NULL },
+         { "2",        NULL },
+         { "3",        NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "snes9x_rewind",
+      "In-Core Rewind",
+      NULL,
+      "Keep a compressed history of recent frames, stepped back through one frame at a time while the rewind button on the first controller is held. The value is the memory the history may use; 64 MB usually holds ten minutes or more. Turn off the frontend's rewind when using this.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "16",       "16 MB" },
+         { "32",       "32 MB" },
+         { "64",       "64 MB" },
+         { "128",      "128 MB" },
+         { "256",      "256 MB" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "snes9x_rewind_button",
+      "In-Core Rewind Button",
+      NULL,
+      "The button on the first controller that steps back through the in-core rewind history while held.",
+      NULL,
+      NULL,
+      {
+         { "L2", NULL },
+         { "R2", NULL },
+         { "L3", NULL },
+         { "R3", NULL },
+         { NULL, NULL },
+      },
+      "L2"
+   },
+   {
+      "snes9x_log_state_hash",
+      "Log State Hash",
+      NULL,
+      "Write a 64-bit fingerprint of the whole emulated state to the log after every frame. Two runs of the same input stay in step exactly as long as their fingerprints match, which finds the frame where a netplay session or a regression run went astray.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "snes9x_rom_info_cache",
+      "Cache ROM Information",
+      NULL,
+      "Remember how each ROM file is laid out, along with its checksum and hashes, in a file in the save directory. Loading the same file again skips working these out, which shortens the start-up of large games. Takes effect when content is loaded.",
+      NULL,
+      NULL,
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "snes9x_show_lightgun_settings",
       "Show Light Gun Settings",
@@ -8,6 +8,7 @@
 #include <iomanip>
 #include <sstream>
 #include <numeric>
+#include <atomic>
 #include <assert.h>
 
 #include "snes9x.h"
@@ -18,16 +19,40 @@
 
 #include <ctype.h>
 #include <sys/stat.h>
+#ifdef _WIN32
+#include <process.h>
+#define getpid	_getpid
+#else
+#include <unistd.h>
+#endif
+#if defined(HAVE_MMAP) || (defined(HAVE_HUGE_PAGES) && defined(__linux__))
+#include <sys/mman.h>
+#endif
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <streams/file_stream.h>
+#endif
+#if defined(S9X_THREAD_INSTANCES) && defined(HAVE_MMAP) && defined(__linux__)
+#define SHARED_ROMS
+#include <mutex>
+#endif
+#ifdef HAVE_THREADS
+#include <thread>
+#endif
+#if defined(__ARM_FEATURE_CRC32) && !defined(MSB_FIRST)
+#define S9X_CRC32_ARMV8
+#include <arm_acle.h>
+#endif
 
 #include "memmap.h"
 #include "s9xbridge.h"
 
-uint8_t  *BridgeSRAM = 0;
-uint8_t  *BridgeROM = 0;
-uint8_t  *BridgeFillRAM = 0;
-uint8_t **BridgeMap = 0;
-uint32_t  BridgeSRAMMask = 0;
-uint32_t  BridgeCalculatedSize = 0;
+S9X_TLS uint8_t  *BridgeSRAM = 0;
+S9X_TLS uint8_t  *BridgeROM = 0;
+S9X_TLS uint8_t  *BridgeFillRAM = 0;
+S9X_TLS uint8_t **BridgeMap = 0;
+S9X_TLS uint32_t  BridgeSRAMMask = 0;
+S9X_TLS uint32_t  BridgeCalculatedSize = 0;
 #include "apu/apu.h"
 #include "fxemu.h"
 #include "sdd1.h"
@@ -892,23 +917,100 @@ static void S9xDeinterleaveGD24 (int size, uint8 *base)
 
 // allocation and deallocation
 
+// The arena goes on whole cache lines. Built with HAVE_HUGE_PAGES it is given
+// a 2 MB transparent huge page of its own, so that walking all of it - which
+// a frame of emulation and every snapshot do - costs a single TLB entry.
+static struct SArena * AllocArena (void **block)
+{
+#if defined(HAVE_HUGE_PAGES) && defined(__linux__)
+	const size_t	huge = 0x200000;
+	const size_t	len  = (sizeof(struct SArena) + huge - 1) & ~(huge - 1);
+
+	if (posix_memalign(block, huge, len) == 0)
+	{
+		madvise(*block, len, MADV_HUGEPAGE);
+		return ((struct SArena *) *block);
+	}
+#endif
+
+	*block = malloc(sizeof(struct SArena) + 63);
+	if (!*block)
+		return (NULL);
+
+	return ((struct SArena *) (((uintptr_t) *block + 63) & ~(uintptr_t) 63));
+}
+
+// The ROM image area: the 32K FillRAM borrows, then the ROM, then room for a
+// copier header. The ROM starts on a page of its own. Built with HAVE_MMAP
+// the area is anonymous memory: pages a game never fills cost nothing, and
+// MapROMFile can put a file in place of the ROM.
+#define ROM_AREA_SIZE	(0x8000 + CMemory::MAX_ROM_SIZE + 0x1000)
+
+static uint8 * AllocROMArea (void)
+{
+#ifdef HAVE_MMAP
+	void	*area = mmap(NULL, ROM_AREA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return (area == MAP_FAILED ? NULL : (uint8 *) area);
+#else
+	return ((uint8 *) calloc(1, ROM_AREA_SIZE));
+#endif
+}
+
+static void FreeROMArea (uint8 *area)
+{
+#ifdef HAVE_MMAP
+	if (area)
+		munmap(area, ROM_AREA_SIZE);
+#else
+	free(area);
+#endif
+}
+
+#ifdef HAVE_MMAP
+static bool8 PageAligned (const uint8 *p)
+{
+	return (((uintptr_t) p & (sysconf(_SC_PAGESIZE) - 1)) == 0);
+}
+#endif
+
 bool8 CMemory::Init (void)
 {
-	IPPU.TileCache[TILE_2BIT]       = (uint8 *) malloc(MAX_2BIT_TILES * 64);
-	IPPU.TileCache[TILE_4BIT]       = (uint8 *) malloc(MAX_4BIT_TILES * 64);
-	IPPU.TileCache[TILE_8BIT]       = (uint8 *) malloc(MAX_8BIT_TILES * 64);
-	IPPU.TileCache[TILE_2BIT_EVEN]  = (uint8 *) malloc(MAX_2BIT_TILES * 64);
-	IPPU.TileCache[TILE_2BIT_ODD]   = (uint8 *) malloc(MAX_2BIT_TILES * 64);
-	IPPU.TileCache[TILE_4BIT_EVEN]  = (uint8 *) malloc(MAX_4BIT_TILES * 64);
-	IPPU.TileCache[TILE_4BIT_ODD]   = (uint8 *) malloc(MAX_4BIT_TILES * 64);
-
-	IPPU.TileCached[TILE_2BIT]      = (uint8 *) malloc(MAX_2BIT_TILES);
-	IPPU.TileCached[TILE_4BIT]      = (uint8 *) malloc(MAX_4BIT_TILES);
-	IPPU.TileCached[TILE_8BIT]      = (uint8 *) malloc(MAX_8BIT_TILES);
-	IPPU.TileCached[TILE_2BIT_EVEN] = (uint8 *) malloc(MAX_2BIT_TILES);
-	IPPU.TileCached[TILE_2BIT_ODD]  = (uint8 *) malloc(MAX_2BIT_TILES);
-	IPPU.TileCached[TILE_4BIT_EVEN] = (uint8 *) malloc(MAX_4BIT_TILES);
-	IPPU.TileCached[TILE_4BIT_ODD]  = (uint8 *) malloc(MAX_4BIT_TILES);
+	Arena = AllocArena(&ArenaBlock);
+	if (!Arena)
+		return (FALSE);
+
+	ROMArea = AllocROMArea();
+	ROMMapped = FALSE;
+	SharedROM = NULL;
+	if (!ROMArea)
+	{
+		Deinit();
+		return (FALSE);
+	}
+
+	RAM  = Arena->RAM;
+	VRAM = Arena->VRAM;
+	SRAM = Arena->SRAM;
+
+	// calloc, not malloc and memset: the seven sets come to over a megabyte,
+	// and a game only ever decodes into some of them. Pages it never touches
+	// are never committed.
+	IPPU.TileCache[TILE_2BIT]       = (uint8 *) calloc(MAX_2BIT_TILES, 64);
+	IPPU.TileCache[TILE_4BIT]       = (uint8 *) calloc(MAX_4BIT_TILES, 64);
+	IPPU.TileCache[TILE_8BIT]       = (uint8 *) calloc(MAX_8BIT_TILES, 64);
+	IPPU.TileCache[TILE_2BIT_EVEN]  = (uint8 *) calloc(MAX_2BIT_TILES, 64);
+	IPPU.TileCache[TILE_2BIT_ODD]   = (uint8 *) calloc(MAX_2BIT_TILES, 64);
+	IPPU.TileCache[TILE_4BIT_EVEN]  = (uint8 *) calloc(MAX_4BIT_TILES, 64);
+	IPPU.TileCache[TILE_4BIT_ODD]   = (uint8 *) calloc(MAX_4BIT_TILES, 64);
+
+	IPPU.TileCached[TILE_2BIT]      = (uint8 *) calloc(MAX_2BIT_TILES, 1);
+	IPPU.TileCached[TILE_4BIT]      = (uint8 *) calloc(MAX_4BIT_TILES, 1);
+	IPPU.TileCached[TILE_8BIT]      = (uint8 *) calloc(MAX_8BIT_TILES, 1);
+	IPPU.TileCached[TILE_2BIT_EVEN] = (uint8 *) calloc(MAX_2BIT_TILES, 1);
+	IPPU.TileCached[TILE_2BIT_ODD]  = (uint8 *) calloc(MAX_2BIT_TILES, 1);
+	IPPU.TileCached[TILE_4BIT_EVEN] = (uint8 *) calloc(MAX_4BIT_TILES, 1);
+	IPPU.TileCached[TILE_4BIT_ODD]  = (uint8 *) calloc(MAX_4BIT_TILES, 1);
 
 	if (!IPPU.TileCache[TILE_2BIT]       ||
 		!IPPU.TileCache[TILE_4BIT]       ||
@@ -929,39 +1031,17 @@ bool8 CMemory::Init (void)
 		return (FALSE);
     }
 
-	ROMStorage.resize(MAX_ROM_SIZE + 0x200 + 0x8000);
-	std::fill(ROMStorage.begin(), ROMStorage.end(), 0);
-	SRAMStorage.resize(SRAM_SIZE);
-	std::fill(SRAMStorage.begin(), SRAMStorage.end(), 0);
-	SRAM = &SRAMStorage[0];
-	memset(RAM, 0,  sizeof(RAM));
-	memset(VRAM, 0, sizeof(VRAM));
-
-	memset(IPPU.TileCache[TILE_2BIT], 0,       MAX_2BIT_TILES * 64);
-	memset(IPPU.TileCache[TILE_4BIT], 0,       MAX_4BIT_TILES * 64);
-	memset(IPPU.TileCache[TILE_8BIT], 0,       MAX_8BIT_TILES * 64);
-	memset(IPPU.TileCache[TILE_2BIT_EVEN], 0,  MAX_2BIT_TILES * 64);
-	memset(IPPU.TileCache[TILE_2BIT_ODD], 0,   MAX_2BIT_TILES * 64);
-	memset(IPPU.TileCache[TILE_4BIT_EVEN], 0,  MAX_4BIT_TILES * 64);
-	memset(IPPU.TileCache[TILE_4BIT_ODD], 0,   MAX_4BIT_TILES * 64);
-
-	memset(IPPU.TileCached[TILE_2BIT], 0,      MAX_2BIT_TILES);
-	memset(IPPU.TileCached[TILE_4BIT], 0,      MAX_4BIT_TILES);
-	memset(IPPU.TileCached[TILE_8BIT], 0,      MAX_8BIT_TILES);
-	memset(IPPU.TileCached[TILE_2BIT_EVEN], 0, MAX_2BIT_TILES);
-	memset(IPPU.TileCached[TILE_2BIT_ODD], 0,  MAX_2BIT_TILES);
-	memset(IPPU.TileCached[TILE_4BIT_EVEN], 0, MAX_4BIT_TILES);
-	memset(IPPU.TileCached[TILE_4BIT_ODD], 0,  MAX_4BIT_TILES);
+	memset(Arena, 0, sizeof(struct SArena));
 
 	// FillRAM uses first 32K of ROM image area, otherwise space just
 	// wasted. Might be read by the SuperFX code.
 
-	FillRAM = &ROMStorage[0];
+	FillRAM = ROMArea;
 
 	// Add 0x8000 to ROM image pointer to stop SuperFX code accessing
 	// unallocated memory (can cause crash on some ports).
 
-	ROM = &ROMStorage[0x8000];
+	ROM = ROMArea + 0x8000;
 
 	C4RAM   = ROM + 0x400000 + 8192 * 8; // C4
 	C4RAMBase = C4RAM;
@@ -999,7 +1079,16 @@ bool8 CMemory::Init (void)
 
 void CMemory::Deinit (void)
 {
-	ROM = NULL;
+	UnshareROM();
+	FreeROMArea(ROMArea);
+	ROMArea = NULL;
+	ROMMapped = FALSE;
+	ROM = FillRAM = NULL;
+
+	free(ArenaBlock);
+	ArenaBlock = NULL;
+	Arena = NULL;
+	RAM = VRAM = SRAM = NULL;
 
 	for (int t = 0; t < 7; t++)
 	{
@@ -1265,7 +1354,7 @@ uint32 CMemory::FileLoader (uint8 *buffer, const char *filename, uint32 maxsize)
 				return (0);
 			}
 
-			ROMFilename = filename;
+			strncpy(ROMFilename, filename, PATH_MAX);
 			break;
 		}
 
@@ -1281,7 +1370,7 @@ uint32 CMemory::FileLoader (uint8 *buffer, const char *filename, uint32 maxsize)
 
 			totalSize = HeaderRemove(size, buffer);
 
-			ROMFilename = filename;
+			strncpy(ROMFilename, filename, PATH_MAX);
 		#else
 			S9xMessage(S9X_ERROR, S9X_ROM_INFO, "This binary was not created with JMA support.");
 			return (0);
@@ -1296,7 +1385,7 @@ uint32 CMemory::FileLoader (uint8 *buffer, const char *filename, uint32 maxsize)
 			if (!fp)
 				return (0);
 
-			ROMFilename = filename;
+			strncpy(ROMFilename, filename, PATH_MAX);
 
 			uint32	size = 0;
 
@@ -1319,23 +1408,490 @@ uint32 CMemory::FileLoader (uint8 *buffer, const char *filename, uint32 maxsize)
 	return ((uint32) totalSize);
 }
 
-bool8 CMemory::LoadROMMem (const uint8 *source, uint32 sourceSize, const char* optional_rom_filename /*= NULL*/)
+// Zeroes the ROM image, dropping a file MapROMFile put there.
+void CMemory::ClearROM (void)
+{
+	UnshareROM();
+
+#ifdef HAVE_MMAP
+	if (PageAligned(ROM) &&
+		mmap(ROM, MAX_ROM_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != MAP_FAILED)
+	{
+		ROMMapped = FALSE;
+		return;
+	}
+#endif
+
+	memset(ROM, 0, MAX_ROM_SIZE);
+	ROMMapped = FALSE;
+}
+
+// Maps a ROM image file over the ROM instead of reading it in, when it is
+// one FileLoader would take as it is: not an archive, and no copier header.
+// The mapping is private, so whatever writes to the ROM later - a header
+// strip, a deinterleave, a patch, a cheat - gets its own copy of just the
+// pages it touches. Every other page stays shared with the page cache, and
+// with every other process running the same game. Only path loads come
+// here; data the frontend has already read is copied. As with any mapped
+// file, one cut short under the running game faults on the next read of a
+// page it lost. Returns the image size, or 0 if the file has to be read
+// instead.
+uint32 CMemory::MapROMFile (const char *filename)
+{
+#ifdef HAVE_MMAP
+	auto path = splitpath(filename);
+	if (path.ext_is(".zip") || path.ext_is(".msu1") || path.ext_is(".jma") || Settings.ForceHeader || !PageAligned(ROM))
+		return (0);
+
+	// The path goes through the VFS first, as FileLoader's would. What it
+	// cannot open is not mapped; what it can, but only the frontend reaches
+	// (a content URI, sandboxed storage), fails the open(2) below or shows a
+	// different size, and is read through the VFS by FileLoader instead.
+	RFILE	*file = filestream_open(filename, RETRO_VFS_FILE_ACCESS_READ, RETRO_VFS_FILE_ACCESS_HINT_NONE);
+	if (!file)
+		return (0);
+
+	int64_t	length = filestream_get_size(file);
+	filestream_close(file);
+
+	int	fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return (0);
+
+	struct stat	st;
+	uint32		size = 0;
+
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size == length &&
+		st.st_size > 0 && st.st_size <= MAX_ROM_SIZE && (st.st_size & 0x1fff) == 0)
+	{
+		ClearROM();
+
+		if (mmap(ROM, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED)
+		{
+			size = (uint32) st.st_size;
+			ROMMapped = TRUE;
+		}
+		else
+			ClearROM();
+	}
+
+	close(fd);
+
+	return (size);
+#else
+	return (0);
+#endif
+}
+
+// Consoles run as threads of one process (S9X_THREAD_INSTANCES) share the
+// ROM images they load. A copied image - one read from an archive, stripped
+// of a header or deinterleaved - is written once into a memfd, listed by its
+// size and SHA-256, and the ROM is mapped privately over it: every console
+// running that game reads the same pages, and whatever writes to its ROM
+// later gets its own copy of just the pages it touches, as with MapROMFile.
+// Images MapROMFile put in place share through the page cache already.
+#ifdef SHARED_ROMS
+struct SSharedROM
+{
+	struct SSharedROM	*next;
+	uint8				sha256[32];
+	size_t				size;
+	int					fd;
+	const uint8			*image;		// read-only view, for comparing against
+	unsigned			users;
+};
+
+static struct SSharedROM	*SharedROMs = NULL;		// process-wide, not per console
+static std::mutex			SharedROMsLock;
+
+static struct SSharedROM * FindSharedROM (const uint8 *rom, size_t size, const uint8 *sha256)
+{
+	for (struct SSharedROM *s = SharedROMs; s; s = s->next)
+	{
+		if (s->size == size && !memcmp(s->sha256, sha256, 32) && !memcmp(s->image, rom, size))
+			return (s);
+	}
+
+	return (NULL);
+}
+
+static struct SSharedROM * NewSharedROM (const uint8 *rom, size_t size, const uint8 *sha256)
+{
+	struct SSharedROM	*s = (struct SSharedROM *) calloc(1, sizeof(struct SSharedROM));
+	if (!s)
+		return (NULL);
+
+	s->fd = memfd_create("snes9x-rom", MFD_CLOEXEC);
+	if (s->fd >= 0 && ftruncate(s->fd, size) == 0)
+	{
+		void	*view = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, s->fd, 0);
+
+		if (view != MAP_FAILED)
+		{
+			memcpy(view, rom, size);
+			mprotect(view, size, PROT_READ);
+
+			s->image = (const uint8 *) view;
+			s->size  = size;
+			memcpy(s->sha256, sha256, 32);
+			s->next  = SharedROMs;
+			SharedROMs = s;
+
+			return (s);
+		}
+	}
+
+	if (s->fd >= 0)
+		close(s->fd);
+	free(s);
+
+	return (NULL);
+}
+
+// Drops s if no console maps it any more. Called with SharedROMsLock held.
+static void ReleaseSharedROM (struct SSharedROM *s)
+{
+	if (s->users)
+		return;
+
+	for (struct SSharedROM **p = &SharedROMs; *p; p = &(*p)->next)
+	{
+		if (*p == s)
+		{
+			*p = s->next;
+			break;
+		}
+	}
+
+	munmap((void *) s->image, s->size);
+	close(s->fd);
+	free(s);
+}
+#endif
+
+// Called once InitROM has settled the image, before anything can write to it.
+void CMemory::ShareROM (void)
+{
+#ifdef SHARED_ROMS
+	size_t	page = sysconf(_SC_PAGESIZE);
+	size_t	size = ((size_t) CalculatedSize + page - 1) & ~(page - 1);
+
+	if (ROMMapped || SharedROM || Multi.cartType || !CalculatedSize || size > MAX_ROM_SIZE || !PageAligned(ROM))
+		return;
+
+	std::lock_guard<std::mutex>	lock(SharedROMsLock);
+
+	struct SSharedROM	*s = FindSharedROM(ROM, size, ROMSHA256);
+	if (!s)
+		s = NewSharedROM(ROM, size, ROMSHA256);
+	if (!s)
+		return;
+
+	if (mmap(ROM, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, s->fd, 0) != MAP_FAILED)
+	{
+		s->users++;
+		SharedROM = s;
+		return;
+	}
+
+	// A failed MAP_FIXED may have taken the old pages with it.
+	mmap(ROM, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+	memcpy(ROM, s->image, size);
+	ReleaseSharedROM(s);
+#endif
+}
+
+void CMemory::UnshareROM (void)
+{
+#ifdef SHARED_ROMS
+	if (!SharedROM)
+		return;
+
+	std::lock_guard<std::mutex>	lock(SharedROMsLock);
+
+	SharedROM->users--;
+	ReleaseSharedROM(SharedROM);
+	SharedROM = NULL;
+#endif
+}
+
+// ROM info cache. Loading a ROM works out how its image is laid out -
+// copier header, interleaving, LoROM or HiROM - by scoring it several ways
+// over, then checksums and hashes all of it. With Settings.ROMInfoCache on,
+// what that came to is kept in a file in the cache directory, keyed by the
+// size and modification time of the file the image came from, a CRC32 of
+// three samples of the image and the settings that steer the detection. A
+// later load of the same file lays the image out as recorded and takes the
+// checksum and hashes from the record, with no pass over the image. Chip
+// detection reads a few header bytes and is left to InitROM. Images LoadROM
+// reads from a path are cached, and those LoadROMMem is given along with the
+// path of the file they are, unpatched and whole.
+//
+// The file is a magic string followed by fixed-size records, most recently
+// stored last, each ending in a CRC32 of the rest; a record that fails it is
+// ignored. The file is rewritten whole on a miss, through a temporary file
+// named for the process and the store, so that concurrent writers never
+// share one.
+
+#define ROMINFO_FILE		"snes9x_rominfo.cache"
+#define ROMINFO_MAGIC		"S9XROMI2"
+#define ROMINFO_RECORD_SIZE	72
+#define ROMINFO_CRC_OFFSET	68
+#define ROMINFO_MAX_RECORDS	4096
+#define ROMINFO_SAMPLE		0x10000
+
+enum
+{
+	DEINTERLEAVE_NONE,
+	DEINTERLEAVE_TALES,
+	DEINTERLEAVE_GD24,
+	DEINTERLEAVE_TYPE2,
+	DEINTERLEAVE_TYPE1
+};
+
+struct SROMInfo
+{
+	// key
+	uint64	mtime;
+	uint32	fileSize;
+	uint32	imageSize;
+	uint32	sampleCRC32;
+	uint16	settings;
+
+	// layout, from DetectROMLayout
+	bool8	headerStripped;
+	bool8	type1First;
+	uint8	extendedFormat;
+	bool8	hiROM;
+	uint8	deinterleave;
+	bool8	swapHalves;
+
+	// from InitROM
+	uint16	checksum;
+	uint32	crc32;
+	uint8	sha256[32];
+};
+
+static bool8 ROMInfoKey (const char *path, const uint8 *image, uint32 imageSize, int headerCount, struct SROMInfo *info)
+{
+	struct stat	st;
+
+	if (stat(path, &st) != 0 || !imageSize)
+		return (FALSE);
+
+	uint32	n = imageSize < ROMINFO_SAMPLE ? imageSize : ROMINFO_SAMPLE;
+	uint32	crc = 0;
+
+	crc = caCRC32((uint8 *) image, n, ~crc);
+	crc = caCRC32((uint8 *) image + (imageSize - n) / 2, n, ~crc);
+	crc = caCRC32((uint8 *) image + imageSize - n, n, ~crc);
+
+	info->mtime       = (uint64) st.st_mtime;
+	info->fileSize    = (uint32) st.st_size;
+	info->imageSize   = imageSize;
+	info->sampleCRC32 = crc;
+	info->settings    = (Settings.ForceLoROM          ? 0x001 : 0) |
+						(Settings.ForceHiROM          ? 0x002 : 0) |
+						(Settings.ForceHeader         ? 0x004 : 0) |
+						(Settings.ForceNoHeader       ? 0x008 : 0) |
+						(Settings.ForceInterleaved    ? 0x010 : 0) |
+						(Settings.ForceInterleaved2   ? 0x020 : 0) |
+						(Settings.ForceInterleaveGD24 ? 0x040 : 0) |
+						(Settings.ForceNotInterleaved ? 0x080 : 0) |
+						(headerCount                  ? 0x100 : 0);
+
+	return (TRUE);
+}
+
+static void PackROMInfo (const struct SROMInfo *info, uint8 *p)
+{
+	memset(p, 0, ROMINFO_RECORD_SIZE);
+	WRITE_DWORD(p +  0, (uint32) info->mtime);
+	WRITE_DWORD(p +  4, (uint32) (info->mtime >> 32));
+	WRITE_DWORD(p +  8, info->fileSize);
+	WRITE_DWORD(p + 12, info->imageSize);
+	WRITE_DWORD(p + 16, info->sampleCRC32);
+	WRITE_WORD (p + 20, info->settings);
+	p[22] = info->headerStripped;
+	p[23] = info->type1First;
+	p[24] = info->extendedFormat;
+	p[25] = info->hiROM;
+	p[26] = info->deinterleave;
+	p[27] = info->swapHalves;
+	WRITE_WORD (p + 28, info->checksum);
+	WRITE_DWORD(p + 32, info->crc32);
+	memcpy(p + 36, info->sha256, 32);
+	WRITE_DWORD(p + ROMINFO_CRC_OFFSET, caCRC32(p, ROMINFO_CRC_OFFSET));
+}
+
+static void UnpackROMInfo (const uint8 *p, struct SROMInfo *info)
+{
+	info->headerStripped = p[22];
+	info->type1First     = p[23];
+	info->extendedFormat = p[24];
+	info->hiROM          = p[25];
+	info->deinterleave   = p[26];
+	info->swapHalves     = p[27];
+	info->checksum       = READ_WORD(p + 28);
+	info->crc32          = READ_DWORD(p + 32);
+	memcpy(info->sha256, p + 36, 32);
+}
+
+// The key is the first 22 bytes of a packed record.
+static bool8 ROMInfoKeyMatches (const uint8 *record, const uint8 *key)
+{
+	return (memcmp(record, key, 22) == 0);
+}
+
+static std::string ROMInfoPath (void)
+{
+	return (S9xGetDirectory(CACHE_DIR) + SLASH_STR + ROMINFO_FILE);
+}
+
+// Reads every intact record in the cache file into records.
+static bool8 ReadROMInfoFile (std::string &records)
+{
+	RFILE	*file = rfopen(ROMInfoPath().c_str(), "rb");
+	if (!file)
+		return (FALSE);
+
+	char	magic[8];
+	uint8	record[ROMINFO_RECORD_SIZE];
+
+	if (rfread(magic, 8, 1, file) == 1 && !memcmp(magic, ROMINFO_MAGIC, 8))
+		while (rfread(record, ROMINFO_RECORD_SIZE, 1, file) == 1)
+			if (READ_DWORD(record + ROMINFO_CRC_OFFSET) == caCRC32(record, ROMINFO_CRC_OFFSET))
+				records.append((const char *) record, ROMINFO_RECORD_SIZE);
+
+	rfclose(file);
+
+	return (TRUE);
+}
+
+static bool8 FindROMInfo (struct SROMInfo *info)
+{
+	std::string	records;
+	uint8		key[ROMINFO_RECORD_SIZE];
+
+	if (!ReadROMInfoFile(records))
+		return (FALSE);
+
+	PackROMInfo(info, key);
+
+	for (size_t i = records.size(); i >= ROMINFO_RECORD_SIZE; i -= ROMINFO_RECORD_SIZE)
+	{
+		const uint8	*record = (const uint8 *) records.data() + i - ROMINFO_RECORD_SIZE;
+
+		if (ROMInfoKeyMatches(record, key))
+		{
+			UnpackROMInfo(record, info);
+			return (info->deinterleave <= DEINTERLEAVE_TYPE1 && info->extendedFormat <= CMemory::SMALLFIRST);
+		}
+	}
+
+	return (FALSE);
+}
+
+static void StoreROMInfo (const struct SROMInfo *info)
+{
+	std::string	records, kept;
+	uint8		record[ROMINFO_RECORD_SIZE];
+
+	ReadROMInfoFile(records);
+	PackROMInfo(info, record);
+
+	// Drop any record with this key, and the oldest beyond the limit.
+	for (size_t i = 0; i < records.size(); i += ROMINFO_RECORD_SIZE)
+		if (!ROMInfoKeyMatches((const uint8 *) records.data() + i, record))
+			kept.append(records, i, ROMINFO_RECORD_SIZE);
+
+	if (kept.size() >= ROMINFO_MAX_RECORDS * ROMINFO_RECORD_SIZE)
+		kept.erase(0, kept.size() - (ROMINFO_MAX_RECORDS - 1) * ROMINFO_RECORD_SIZE);
+
+	kept.append((const char *) record, ROMINFO_RECORD_SIZE);
+
+	// Another instance may be reading the file, or storing its own: write a
+	// new one under a name no other writer uses and move it into place.
+	static std::atomic<uint32>	stores(0);
+
+	std::string	path = ROMInfoPath();
+	std::string	temp = path + "." + std::to_string((long) getpid()) + "." + std::to_string(stores++) + ".tmp";
+	RFILE		*file = rfopen(temp.c_str(), "wb");
+	if (!file)
+		return;
+
+	bool8	written = rfwrite(ROMINFO_MAGIC, 8, 1, file) == 1 && rfwrite(kept.data(), kept.size(), 1, file) == 1;
+	rfclose(file);
+
+	if (!written || (rename(temp.c_str(), path.c_str()) != 0 &&
+		(remove(path.c_str()), rename(temp.c_str(), path.c_str()) != 0)))
+		remove(temp.c_str());
+}
+
+// Undoes the interleaving DetectROMLayout found.
+static void DeinterleaveROM (uint8 *rom, uint32 size, uint8 mode, uint8 extendedFormat)
+{
+	S9xMessage(S9X_INFO, S9X_ROM_INTERLEAVED_INFO, "ROM image is in interleaved format - converting...");
+
+	switch (mode)
+	{
+		case DEINTERLEAVE_TALES:
+			if (extendedFormat == CMemory::BIGFIRST)
+			{
+				S9xDeinterleaveType1(0x400000, rom);
+				S9xDeinterleaveType1(size - 0x400000, rom + 0x400000);
+			}
+			else
+			{
+				S9xDeinterleaveType1(size - 0x400000, rom);
+				S9xDeinterleaveType1(0x400000, rom + size - 0x400000);
+			}
+			break;
+
+		case DEINTERLEAVE_GD24:
+			S9xDeinterleaveGD24(size, rom);
+			break;
+
+		case DEINTERLEAVE_TYPE2:
+			S9xDeinterleaveType2(size, rom);
+			break;
+
+		case DEINTERLEAVE_TYPE1:
+			S9xDeinterleaveType1(size, rom);
+			break;
+	}
+}
+
+static void SwapExHiROMHalves (uint8 *rom, uint32 size)
+{
+	uint8	*tmp = (uint8 *) malloc(size - 0x400000);
+	if (tmp)
+	{
+		S9xMessage(S9X_INFO, S9X_ROM_INTERLEAVED_INFO, "Fixing swapped ExHiROM...");
+		memmove(tmp, rom, size - 0x400000);
+		memmove(rom, rom + size - 0x400000, 0x400000);
+		memmove(rom + 0x400000, tmp, size - 0x400000);
+		free(tmp);
+	}
+}
+
+bool8 CMemory::LoadROMMem (const uint8 *source, uint32 sourceSize, const char* optional_rom_filename /*= NULL*/, const char *imagePath /*= NULL*/)
 {
     if(!source || sourceSize > MAX_ROM_SIZE)
         return FALSE;
 
     if (optional_rom_filename)
-        ROMFilename = optional_rom_filename;
+        strncpy(ROMFilename, optional_rom_filename, PATH_MAX);
     else
-        ROMFilename = "MemoryROM";
+        strncpy(ROMFilename, "MemoryROM", PATH_MAX);
 
     do
     {
-        memset(ROM,0, MAX_ROM_SIZE);
         memset(&Multi, 0,sizeof(Multi));
+        ClearROM();
         memcpy(ROM,source,sourceSize);
     }
-    while(!LoadROMInt(sourceSize));
+    while(!LoadROMInt(sourceSize, imagePath));
 
     return TRUE;
 }
@@ -1350,21 +1906,32 @@ bool8 CMemory::LoadROM (const char *filename)
 
     do
     {
-        memset(ROM,0, MAX_ROM_SIZE);
         memset(&Multi, 0,sizeof(Multi));
-        totalFileSize = FileLoader(ROM, filename, MAX_ROM_SIZE);
+
+        if ((totalFileSize = MapROMFile(filename)))
+        {
+            memset(NSRTHeader, 0, sizeof(NSRTHeader));
+            HeaderCount = 0;
+            strncpy(ROMFilename, filename, PATH_MAX);
+            S9xMessage(S9X_INFO, S9X_HEADERS_INFO, "No ROM file header found.");
+        }
+        else
+        {
+            ClearROM();
+            totalFileSize = FileLoader(ROM, filename, MAX_ROM_SIZE);
+        }
 
         if (!totalFileSize)
             return (FALSE);
 
         CheckForAnyPatch(filename, HeaderCount != 0, totalFileSize);
     }
-    while(!LoadROMInt(totalFileSize));
+    while(!LoadROMInt(totalFileSize, Settings.IsPatched ? NULL : filename));
 
     return TRUE;
 }
 
-bool8 CMemory::LoadROMInt (int32 ROMfillSize)
+bool8 CMemory::LoadROMInt (int32 ROMfillSize, const char *imagePath)
 {
 	Settings.DisplayColor = BUILD_PIXEL(31, 31, 31);
 	SET_UI_COLOR(255, 255, 255);
@@ -1372,6 +1939,44 @@ bool8 CMemory::LoadROMInt (int32 ROMfillSize)
 	CalculatedSize = 0;
 	ExtendedFormat = NOPE;
 
+	struct SROMInfo	info;
+	memset(&info, 0, sizeof(info));
+
+	bool8	keyed  = Settings.ROMInfoCache && imagePath && ROMInfoKey(imagePath, ROM, ROMfillSize, HeaderCount, &info);
+	bool8	cached = keyed && FindROMInfo(&info);
+
+	if (cached)
+		ApplyROMLayout(ROMfillSize, &info);
+	else if (!DetectROMLayout(ROMfillSize, &info))
+		return (FALSE);
+
+	memset(&SNESGameFixes, 0, sizeof(SNESGameFixes));
+	SNESGameFixes.SRAMInitialValue = 0x60;
+
+	InitROM(cached ? &info : NULL);
+	ShareROM();
+
+	if (keyed && !cached)
+	{
+		info.checksum = CalculatedChecksum;
+		info.crc32    = ROMCRC32;
+		memcpy(info.sha256, ROMSHA256, 32);
+		StoreROMInfo(&info);
+	}
+
+	S9xReset();
+
+	S9xDeleteCheats();
+	S9xLoadCheatFile(S9xGetFilename(".cht", CHEAT_DIR).c_str());
+
+    return (TRUE);
+}
+
+// Works out from the image how it is laid out - copier header, interleaving,
+// LoROM or HiROM - puts it in order and notes in info what it did. FALSE
+// means the settings were changed to have another go at the image.
+bool8 CMemory::DetectROMLayout (int32 &ROMfillSize, struct SROMInfo *info)
+{
 	int	hi_score, lo_score;
 	int score_headered;
 	int score_nonheadered;
@@ -1391,6 +1996,7 @@ bool8 CMemory::LoadROMInt (int32 ROMfillSize)
 	{
 		memmove(ROM, ROM + 512, ROMfillSize - 512);
 		ROMfillSize -= 512;
+		info->headerStripped = TRUE;
 		S9xMessage(S9X_INFO, S9X_HEADER_WARNING, "Try 'force no-header' option if the game doesn't work");
 		// modifying ROM, so we need to rescore
 		hi_score = ScoreHiROM(FALSE);
@@ -1418,7 +2024,10 @@ bool8 CMemory::LoadROMInt (int32 ROMfillSize)
 		((ROM[0xfffc] + (ROM[0xfffd] << 8)) < 0x8000))
 	{
 		if (!Settings.ForceInterleaved && !Settings.ForceNotInterleaved)
+		{
 			S9xDeinterleaveType1(ROMfillSize, ROM);
+			info->type1First = TRUE;
+		}
 	}
 
 	// CalculatedSize is now set, so rescore
@@ -1503,21 +2112,9 @@ bool8 CMemory::LoadROMInt (int32 ROMfillSize)
 
 	if (!Settings.ForceNotInterleaved && interleaved)
 	{
-		S9xMessage(S9X_INFO, S9X_ROM_INTERLEAVED_INFO, "ROM image is in interleaved format - converting...");
-
 		if (tales)
 		{
-			if (ExtendedFormat == BIGFIRST)
-			{
-				S9xDeinterleaveType1(0x400000, ROM);
-				S9xDeinterleaveType1(CalculatedSize - 0x400000, ROM + 0x400000);
-			}
-			else
-			{
-				S9xDeinterleaveType1(CalculatedSize - 0x400000, ROM);
-				S9xDeinterleaveType1(0x400000, ROM + CalculatedSize - 0x400000);
-			}
-
+			info->deinterleave = DEINTERLEAVE_TALES;
 			LoROM = FALSE;
 			HiROM = TRUE;
 		}
@@ -1526,18 +2123,20 @@ bool8 CMemory::LoadROMInt (int32 ROMfillSize)
 			bool8	t = LoROM;
 			LoROM = HiROM;
 			HiROM = t;
-			S9xDeinterleaveGD24(CalculatedSize, ROM);
+			info->deinterleave = DEINTERLEAVE_GD24;
 		}
 		else if (Settings.ForceInterleaved2)
-			S9xDeinterleaveType2(CalculatedSize, ROM);
+			info->deinterleave = DEINTERLEAVE_TYPE2;
 		else
 		{
 			bool8	t = LoROM;
 			LoROM = HiROM;
 			HiROM = t;
-			S9xDeinterleaveType1(CalculatedSize, ROM);
+			info->deinterleave = DEINTERLEAVE_TYPE1;
 		}
 
+		DeinterleaveROM(ROM, CalculatedSize, info->deinterleave, ExtendedFormat);
+
 		hi_score = ScoreHiROM(FALSE);
 		lo_score = ScoreLoROM(FALSE);
 
@@ -1555,29 +2154,41 @@ bool8 CMemory::LoadROMInt (int32 ROMfillSize)
 		tales = TRUE;
 
 	if (tales)
+		SwapExHiROMHalves(ROM, CalculatedSize);
+
+	info->swapHalves = tales;
+	info->extendedFormat = ExtendedFormat;
+	info->hiROM = HiROM;
+
+	return (TRUE);
+}
+
+// Lays the image out as DetectROMLayout recorded it would, without the
+// detection.
+void CMemory::ApplyROMLayout (int32 &ROMfillSize, const struct SROMInfo *info)
+{
+	if (info->headerStripped)
 	{
-		uint8	*tmp = (uint8 *) malloc(CalculatedSize - 0x400000);
-		if (tmp)
-		{
-			S9xMessage(S9X_INFO, S9X_ROM_INTERLEAVED_INFO, "Fixing swapped ExHiROM...");
-			memmove(tmp, ROM, CalculatedSize - 0x400000);
-			memmove(ROM, ROM + CalculatedSize - 0x400000, 0x400000);
-			memmove(ROM + 0x400000, tmp, CalculatedSize - 0x400000);
-			free(tmp);
-		}
+		memmove(ROM, ROM + 512, ROMfillSize - 512);
+		ROMfillSize -= 512;
+		S9xMessage(S9X_INFO, S9X_HEADER_WARNING, "Try 'force no-header' option if the game doesn't work");
 	}
 
-	memset(&SNESGameFixes, 0, sizeof(SNESGameFixes));
-	SNESGameFixes.SRAMInitialValue = 0x60;
+	CalculatedSize = ((ROMfillSize + 0x1fff) / 0x2000) * 0x2000;
 
-	InitROM();
+	if (info->type1First)
+		S9xDeinterleaveType1(ROMfillSize, ROM);
 
-	S9xReset();
+	ExtendedFormat = info->extendedFormat;
 
-	S9xDeleteCheats();
-	S9xLoadCheatFile(S9xGetFilename(".cht", CHEAT_DIR).c_str());
+	if (info->deinterleave != DEINTERLEAVE_NONE)
+		DeinterleaveROM(ROM, CalculatedSize, info->deinterleave, ExtendedFormat);
 
-    return (TRUE);
+	HiROM = info->hiROM;
+	LoROM = !HiROM;
+
+	if (info->swapHalves)
+		SwapExHiROMHalves(ROM, CalculatedSize);
 }
 
 bool8 CMemory::LoadMultiCartMem (const uint8 *sourceA, uint32 sourceASize,
@@ -1585,7 +2196,7 @@ bool8 CMemory::LoadMultiCartMem (const uint8 *sourceA, uint32 sourceASize,
                                  const uint8 *bios, uint32 biosSize)
 {
     uint32 offset = 0;
-    memset(ROM, 0, MAX_ROM_SIZE);
+    ClearROM();
 	memset(&Multi, 0, sizeof(Multi));
 
     if(bios) {
@@ -1618,7 +2229,7 @@ bool8 CMemory::LoadMultiCartMem (const uint8 *sourceA, uint32 sourceASize,
 bool8 CMemory::LoadMultiCart (const char *cartA, const char *cartB)
 {
 
-    memset(ROM, 0, MAX_ROM_SIZE);
+    ClearROM();
 	memset(&Multi, 0, sizeof(Multi));
 
 	Settings.DisplayColor = BUILD_PIXEL(31, 31, 31);
@@ -1698,7 +2309,7 @@ bool8 CMemory::LoadMultiCartInt ()
 	    else
 		    return (FALSE);
 
-        ROMFilename = path;
+        strncpy(ROMFilename, path.c_str(), PATH_MAX);
     }
 
 	switch (Multi.cartType)
@@ -1723,9 +2334,9 @@ bool8 CMemory::LoadMultiCartInt ()
 	}
 
 	if (Multi.cartSizeA)
-		ROMFilename = Multi.fileNameA;
+		strcpy(ROMFilename, Multi.fileNameA);
 	else if (Multi.cartSizeB)
-		ROMFilename = Multi.fileNameB;
+		strcpy(ROMFilename, Multi.fileNameB);
 
 	memset(&SNESGameFixes, 0, sizeof(SNESGameFixes));
 	SNESGameFixes.SRAMInitialValue = 0x60;
@@ -2010,10 +2621,50 @@ bool8 CMemory::SaveMPAK (const char *filename)
 
 // initialization
 
+#ifndef S9X_CRC32_ARMV8
+// Slice-by-8: crc32Slices[k][b] is the CRC of byte b followed by k zero
+// bytes, so eight bytes are folded in with eight independent lookups.
+static uint32	crc32Slices[8][256];
+
+static const uint32 (* BuildCRC32Slices (void))[256]
+{
+	for (int b = 0; b < 256; b++)
+	{
+		crc32Slices[0][b] = crc32Table[b];
+		for (int k = 1; k < 8; k++)
+			crc32Slices[k][b] = (crc32Slices[k - 1][b] >> 8) ^ crc32Table[crc32Slices[k - 1][b] & 0xFF];
+	}
+
+	return (crc32Slices);
+}
+#endif
+
 static uint32 caCRC32 (uint8 *array, uint32 size, uint32 crc32)
 {
-	for (uint32 i = 0; i < size; i++)
-		crc32 = ((crc32 >> 8) & 0x00FFFFFF) ^ crc32Table[(crc32 ^ array[i]) & 0xFF];
+#ifdef S9X_CRC32_ARMV8
+	for (; size >= 8; size -= 8, array += 8)
+	{
+		uint64	d;
+		memcpy(&d, array, 8);
+		crc32 = __crc32d(crc32, d);
+	}
+
+	for (; size; size--)
+		crc32 = __crc32b(crc32, *array++);
+#else
+	static const uint32	(*t)[256] = BuildCRC32Slices();	// once per process, thread-safe
+
+	for (; size >= 8; size -= 8, array += 8)
+	{
+		uint32	lo = READ_DWORD(array) ^ crc32, hi = READ_DWORD(array + 4);
+
+		crc32 = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+				t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+	}
+
+	for (; size; size--)
+		crc32 = ((crc32 >> 8) & 0x00FFFFFF) ^ crc32Table[(crc32 ^ *array++) & 0xFF];
+#endif
 
 	return (~crc32);
 }
@@ -2065,7 +2716,7 @@ void CMemory::ParseSNESHeader (uint8 *RomHeader)
 	}
 }
 
-void CMemory::InitROM (void)
+void CMemory::InitROM (const struct SROMInfo *cached)
 {
 	Settings.SuperFX = FALSE;
 	Settings.DSP = 0;
@@ -2268,6 +2919,18 @@ void CMemory::InitROM (void)
 
 	//// Map memory and calculate checksum
 
+	// A BS dump is hashed with two of its header bytes rewritten (below).
+	// Any other ROM is left alone from here on, so its SHA-256, the longest
+	// pass over it, is taken on another core while the memory map is set up
+	// and the checksum and CRC32 are worked out. A ROM info cache hit
+	// (see LoadROMInt) brings all three with it.
+	bool8	bsDump = Settings.BS && !Settings.BSXItself;
+#ifdef HAVE_THREADS
+	std::thread	sha256Worker;
+	if (!cached && !bsDump && std::thread::hardware_concurrency() > 1)
+		sha256Worker = std::thread(sha256sum, ROM, CalculatedSize, ROMSHA256);
+#endif
+
 	Map_Initialize();
 	CalculatedChecksum = 0;
 
@@ -2335,7 +2998,10 @@ void CMemory::InitROM (void)
 			Map_LoROMMap();
     }
 
-	Checksum_Calculate();
+	if (cached)
+		CalculatedChecksum = cached->checksum;
+	else
+		Checksum_Calculate();
 
 	bool8 isChecksumOK = (ROMChecksum + ROMComplementChecksum == 0xffff) &
 						 (ROMChecksum == CalculatedChecksum);
@@ -2343,9 +3009,19 @@ void CMemory::InitROM (void)
 	//// Build more ROM information
 
 	// CRC32
-	if (!Settings.BS || Settings.BSXItself) // Not BS Dump
+	if (cached)
+	{
+		ROMCRC32 = cached->crc32;
+		memcpy(ROMSHA256, cached->sha256, 32);
+	}
+	else if (!bsDump)
 	{
 		ROMCRC32 = caCRC32(ROM, CalculatedSize);
+#ifdef HAVE_THREADS
+		if (sha256Worker.joinable())
+			sha256Worker.join();
+		else
+#endif
 		sha256sum(ROM, CalculatedSize, ROMSHA256);
 	}
 	else // Convert to correct format before scan
@@ -3306,7 +3982,7 @@ const char * CMemory::MapType (void)
 
 const char * CMemory::StaticRAMSize (void)
 {
-	static char	str[20];
+	static S9X_TLS char	str[20];
 
 	if (SRAMSize > 16)
 		strcpy(str, "Corrupt");
@@ -3318,7 +3994,7 @@ const char * CMemory::StaticRAMSize (void)
 
 const char * CMemory::Size (void)
 {
-	static char	str[20];
+	static S9X_TLS char	str[20];
 
 	if (Multi.cartType == 4)
 		strcpy(str, "N/A");
@@ -3332,7 +4008,7 @@ const char * CMemory::Size (void)
 
 const char * CMemory::Revision (void)
 {
-	static char	str[20];
+	static S9X_TLS char	str[20];
 
 	sprintf(str, "1.%d", HiROM ? ((ExtendedFormat != NOPE) ? ROM[0x40ffdb] : ROM[0xffdb]) : ROM[0x7fdb]);
 
@@ -3341,7 +4017,7 @@ const char * CMemory::Revision (void)
 
 const char * CMemory::KartContents (void)
 {
-	static char			str[64];
+	static S9X_TLS char			str[64];
 	static const char	*contents[3] = { "ROM", "ROM+RAM", "ROM+RAM+BAT" };
 
 	char	chip[20];
@@ -4083,7 +4759,7 @@ extern "C" uint8_t BSXGetSettingBSXBootup (void)   { return Settings.BSXBootup;
 
 extern "C" const char *BSXGetSatDirectory (void)
 {
-	static char buf[PATH_MAX + 1];
+	static S9X_TLS char buf[PATH_MAX + 1];
 	strncpy(buf, S9xGetDirectory(SAT_DIR).c_str(), PATH_MAX);
 	buf[PATH_MAX] = 0;
 	return buf;
@@ -4091,7 +4767,7 @@ extern "C" const char *BSXGetSatDirectory (void)
 
 extern "C" const char *BSXGetBIOSDirectory (void)
 {
-	static char buf[PATH_MAX + 1];
+	static S9X_TLS char buf[PATH_MAX + 1];
 	strncpy(buf, S9xGetDirectory(BIOS_DIR).c_str(), PATH_MAX);
 	buf[PATH_MAX] = 0;
 	return buf;
@@ -16,6 +16,17 @@
 #include <vector>
 #include <cstdint>
 
+// The machine's large working memories, in one cache-aligned allocation made
+// by CMemory::Init. Nothing in it is a pointer, so a raw snapshot
+// (S9xFreezeRaw) takes it with a single copy.
+struct SArena
+{
+	uint8	RAM[0x20000];
+	uint8	VRAM[0x10000];
+	uint8	APURAM[0x10000];
+	uint8	SRAM[0x80000];
+};
+
 struct CMemory
 {
 	enum
@@ -57,13 +68,17 @@ struct CMemory
 	uint8	NSRTHeader[32];
 	int32	HeaderCount;
 
-	uint8	RAM[0x20000];
-	std::vector<uint8_t> ROMStorage;
+	struct SArena	*Arena;
+	void	*ArenaBlock;
+
+	uint8	*RAM;
+	uint8	*ROMArea;
+	bool8	ROMMapped;
+	struct SSharedROM	*SharedROM;
 	uint8   *ROM;
-	std::vector<uint8_t> SRAMStorage;
 	uint8	*SRAM;
-	const size_t SRAM_SIZE = 0x80000;
-	uint8	VRAM[0x10000];
+	static const size_t SRAM_SIZE = sizeof(SArena::SRAM);
+	uint8	*VRAM;
 	uint8	*FillRAM;
 	uint8	*BWRAM;
 	uint8	*C4RAM;
@@ -77,7 +92,7 @@ struct CMemory
 	uint8	BlockIsROM[MEMMAP_NUM_BLOCKS];
 	uint8	ExtendedFormat;
 
-	std::string ROMFilename;
+	char	ROMFilename[PATH_MAX + 1];
 	char	ROMName[ROM_NAME_LEN];
 	char	ROMId[5];
 	int32	CompanyId;
@@ -109,9 +124,15 @@ struct CMemory
 	int		First512BytesCountZeroes() const;
 	uint32	HeaderRemove (uint32, uint8 *);
 	uint32	FileLoader (uint8 *, const char *, uint32);
-    bool8   LoadROMMem (const uint8 *, uint32, const char* optional_rom_filename = NULL);
+	void	ClearROM (void);
+	uint32	MapROMFile (const char *);
+	void	ShareROM (void);
+	void	UnshareROM (void);
+    bool8   LoadROMMem (const uint8 *, uint32, const char* optional_rom_filename = NULL, const char *imagePath = NULL);
 	bool8	LoadROM (const char *);
-    bool8	LoadROMInt (int32);
+    bool8	LoadROMInt (int32, const char *imagePath = NULL);
+	bool8	DetectROMLayout (int32 &, struct SROMInfo *);
+	void	ApplyROMLayout (int32 &, const struct SROMInfo *);
     bool8   LoadMultiCartMem (const uint8 *, uint32, const uint8 *, uint32, const uint8 *, uint32);
 	bool8	LoadMultiCart (const char *, const char *);
     bool8	LoadMultiCartInt ();
@@ -126,7 +147,7 @@ struct CMemory
 	bool8	SaveMPAK (const char *);
 
 	void	ParseSNESHeader (uint8 *);
-	void	InitROM (void);
+	void	InitROM (const struct SROMInfo *cached = NULL);
 
 	uint32	map_mirror (uint32, uint32);
 	void	map_lorom (uint32, uint32, uint32, uint32, uint32);
@@ -199,8 +220,8 @@ struct SMulti
 	char	fileNameA[PATH_MAX + 1], fileNameB[PATH_MAX + 1];
 };
 
-extern CMemory	Memory;
-extern SMulti	Multi;
+extern S9X_TLS CMemory	Memory;
+extern S9X_TLS SMulti	Multi;
 
 inline bool S9xInterlaceField()
 {
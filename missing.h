@@ -78,7 +78,7 @@ struct Missing
 	uint16	unknowndsp_write;
 };
 
-extern struct Missing	missing;
+extern S9X_TLS struct Missing	missing;
 
 #endif
 
@@ -35,8 +35,8 @@ struct msu1_src
 	uint32_t		 size;
 };
 
-static struct msu1_src	dataSrc;
-static struct msu1_src	audioSrc;
+static S9X_TLS struct msu1_src	dataSrc;
+static S9X_TLS struct msu1_src	audioSrc;
 
 static uint8_t msu1_src_open (struct msu1_src *src, const char *loose_path,
                               const char *pack_path, const char *suffix);
@@ -46,24 +46,24 @@ static uint32_t msu1_src_read (struct msu1_src *src, uint32_t offset, uint8_t *o
 /* Kept as the "is it mounted" predicate the rest of the file already reads. */
 #define dataFile   (dataSrc.loose  || dataSrc.packed)
 #define audioFile  (audioSrc.loose || audioSrc.packed)
-static char		 msu1_rom_path[PATH_MAX + 1] = { 0 };
-static uint8_t		 msu1_have_path = FALSE;
+static S9X_TLS char		 msu1_rom_path[PATH_MAX + 1] = { 0 };
+static S9X_TLS uint8_t		 msu1_have_path = FALSE;
 
 /* Audio fast path: the per-sample generator must not touch the FILE stream
    (ftell/fseek/fgetc per sample throttles emulation badly). Instead we cache
    the track size once at open, track the play cursor as an integer byte
    offset, and stream PCM through a RAM buffer, refilling in bulk. */
-static long		 audio_size = 0;                 /* cached track file size */
-static uint32_t		 audio_cursor = 0;               /* absolute byte offset of next sample */
+static S9X_TLS long		 audio_size = 0;                 /* cached track file size */
+static S9X_TLS uint32_t		 audio_cursor = 0;               /* absolute byte offset of next sample */
 #define MSU1_AUDIO_BUFSZ	8192                     /* PCM read-ahead buffer (bytes) */
-static uint8_t		 audio_buf[MSU1_AUDIO_BUFSZ];
-static uint32_t		 audio_buf_base = 0;             /* file offset of audio_buf[0] */
-static uint32_t		 audio_buf_len  = 0;             /* valid bytes in audio_buf */
+static S9X_TLS uint8_t		 audio_buf[MSU1_AUDIO_BUFSZ];
+static S9X_TLS uint32_t		 audio_buf_base = 0;             /* file offset of audio_buf[0] */
+static S9X_TLS uint32_t		 audio_buf_len  = 0;             /* valid bytes in audio_buf */
 /* Track number audioFile currently holds, or ~0U when nothing is open. Lets a
    savestate load skip the close/open/header-parse when the state names the
    track that is already mounted - which is every load under Preemptive
    Frames, up to once per displayed frame. */
-static uint32_t		 audio_open_track = ~0U;
+static S9X_TLS uint32_t		 audio_open_track = ~0U;
 
 /* Path helpers ----------------------------------------------------------------
 
@@ -100,7 +100,7 @@ struct SMSU1
 	uint8_t		MSU1_EnhFill;	/* valid frames in the pair: 0..2 */
 };
 
-extern struct SMSU1	MSU1;
+extern S9X_TLS struct SMSU1	MSU1;
 
 /* Lifecycle */
 void	S9xResetMSU1 (void);
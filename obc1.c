@@ -181,7 +181,7 @@
 #include "port.h"
 #include "obc1.h"
 
-uint8_t *OBC1RAMBase = 0;
+S9X_TLS uint8_t *OBC1RAMBase = 0;
 
 uint8_t S9xGetOBC1 (uint16_t Address)
 {
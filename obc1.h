@@ -186,7 +186,7 @@
 extern "C" {
 #endif
 
-extern uint8_t *OBC1RAMBase;
+extern S9X_TLS uint8_t *OBC1RAMBase;
 
 struct SOBC1
 {
@@ -195,7 +195,7 @@ struct SOBC1
 	uint16_t	shift;
 };
 
-extern struct SOBC1	OBC1;
+extern S9X_TLS struct SOBC1	OBC1;
 
 void S9xSetOBC1 (uint8_t, uint16_t);
 uint8_t S9xGetOBC1 (uint16_t);
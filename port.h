@@ -32,6 +32,37 @@
 #define alwaysinline  inline
 #endif
 
+/* Emulator state - every global and static a running console writes - is
+ * declared S9X_TLS. Built with S9X_THREAD_INSTANCES, that makes it thread
+ * local, and every thread that drives the core runs a console of its own;
+ * otherwise it expands to nothing. Tables that are only ever read are left
+ * shared.
+ *
+ * C++ thread_local has every access to an extern variable go through a call
+ * that constructs it on first use, even when there is nothing to construct.
+ * GCC and Clang's __thread admits no constructors and needs no such call, so
+ * plain data uses that, and the few objects with constructors (containers,
+ * strings) are declared S9X_TLS_OBJECT. Keep those off the hot paths. */
+#ifdef S9X_THREAD_INSTANCES
+#if defined(__cplusplus)
+#if defined(__GNUC__)
+#define S9X_TLS			__thread
+#else
+#define S9X_TLS			thread_local
+#endif
+#define S9X_TLS_OBJECT	thread_local
+#elif defined(_MSC_VER)
+#define S9X_TLS			__declspec(thread)
+#define S9X_TLS_OBJECT	__declspec(thread)
+#else
+#define S9X_TLS			_Thread_local
+#define S9X_TLS_OBJECT	_Thread_local
+#endif
+#else
+#define S9X_TLS
+#define S9X_TLS_OBJECT
+#endif
+
 #ifndef snes9x_types_defined
 #define snes9x_types_defined
 typedef unsigned char		bool8;
@@ -18,7 +18,7 @@
 #include "missing.h"
 #endif
 
-extern uint8	*HDMAMemPointers[8];
+extern S9X_TLS uint8	*HDMAMemPointers[8];
 
 
 static inline void S9xLatchCounters (bool force)
@@ -1586,7 +1586,7 @@ uint8 S9xGetCPU (uint16 Address)
 	if (Address < 0x4200)
 	{
 	#ifdef SNES_JOY_READ_CALLBACKS
-		extern bool8 pad_read;
+		extern S9X_TLS bool8 pad_read;
 		if (Address == 0x4016 || Address == 0x4017)
 		{
 			S9xOnSNESPadRead();
@@ -1712,7 +1712,7 @@ uint8 S9xGetCPU (uint16 Address)
 			case 0x421e: // JOY4L
 			case 0x421f: // JOY4H
 			#ifdef SNES_JOY_READ_CALLBACKS
-				extern bool8 pad_read;
+				extern S9X_TLS bool8 pad_read;
 				if (Memory.FillRAM[0x4200] & 1)
 				{
 					S9xOnSNESPadRead();
@@ -1740,11 +1740,18 @@ void S9xResetPPU (void)
 	PPU.M7byte = 0;
 }
 
+// What a fast snapshot load resets. What was decoded from VRAM is left to
+// the loader: see S9xInvalidateVRAMChanges.
 void S9xResetPPUFast (void)
 {
 	PPU.RecomputeClipWindows = TRUE;
 	IPPU.ColorsChanged = TRUE;
 	IPPU.OBJChanged = TRUE;
+}
+
+// Forget everything decoded from VRAM: the tile caches and the Mode 7 planes.
+void S9xInvalidateTileCache (void)
+{
 	memset(IPPU.TileCached[TILE_2BIT], 0, MAX_2BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT], 0, MAX_4BIT_TILES);
 	memset(IPPU.TileCached[TILE_8BIT], 0, MAX_8BIT_TILES);
@@ -1752,62 +1759,77 @@ void S9xResetPPUFast (void)
 	memset(IPPU.TileCached[TILE_2BIT_ODD], 0, MAX_2BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_EVEN], 0, MAX_4BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_ODD], 0, MAX_4BIT_TILES);
+	memset(IPPU.Mode7Cached, 0, sizeof(IPPU.Mode7Cached));
 }
 
-void S9xMode7VertResample (void)
+// VRAM is about to be replaced by vram all at once, by a snapshot load.
+// Forget only what was decoded from bytes that change, as the VRAM port
+// would had it written them: a rollback to a nearly equal state keeps most
+// of the cache.
+void S9xInvalidateVRAMChanges (const uint8 *vram)
 {
-	int32 y, m7_start;
-	uint32 ppl;
-	uint32 width;
-
-	if (IPPU.M7VertStartY < 0)
-		return;
-
-	/* (snes9x2010 aborts its software-framebuffer hook here; this port
-	   has no such hook -- GFX.Screen is always the persistent buffer,
-	   sized MAX_SNES_WIDTH_4X x (MAX_SNES_HEIGHT + 64).) */
-	m7_start = IPPU.M7VertStartY;
-	ppl      = GFX.PPL;
-	width    = IPPU.RenderedScreenWidth;
-
-	/* An interlaced frame is already two fields tall: the renderer writes
-	   PPU.ScreenHeight rows at twice the normal stride, so the frame
-	   already occupies 2 * PPU.ScreenHeight physical rows. Doubling again
-	   here would need four times the height - 956 rows at 239-line
-	   overscan against the 510 the buffer holds - and the bottom-up walk
-	   writes those rows before anything notices, roughly 850 KB past the
-	   end of GFXScreenBuffer and straight through whatever the allocator
-	   put after it. Interlace already provides the vertical resolution
-	   this pass exists to synthesise, so skip it. */
-	if (ppl != (uint32) GFX.RealPPL)
-		return;
-
-	/* Backstop for any future path that arms the pass with a taller frame
-	   or a wider stride: refuse rather than write past the buffer. The
-	   usable region below GFX.Screen is (MAX_SNES_HEIGHT + 32) rows of
-	   RealPPL, the 64 rows of slack in GFXScreenBuffer less the 32-row
-	   offset GFX.Screen sits at. */
+	for (uint32 page = 0; page < 0x10000; page += 0x100)
 	{
-		uint32 max_rows = ((uint32) GFX.RealPPL * (MAX_SNES_HEIGHT + 32)) / ppl;
+		if (!memcmp(Memory.VRAM + page, vram + page, 0x100))
+			continue;
 
-		if ((uint32) PPU.ScreenHeight * 2 > max_rows)
-			return;
+		IPPU.Mode7Cached[page >> 8] = FALSE;
+
+		// a 2bpp tile at a time, the smallest cached unit
+		for (uint32 address = page; address < page + 0x100; address += 16)
+		{
+			if (!memcmp(Memory.VRAM + address, vram + address, 16))
+				continue;
+
+			IPPU.TileCached[TILE_2BIT][address >> 4] = FALSE;
+			IPPU.TileCached[TILE_4BIT][address >> 5] = FALSE;
+			IPPU.TileCached[TILE_8BIT][address >> 6] = FALSE;
+			IPPU.TileCached[TILE_2BIT_EVEN][address >> 4] = FALSE;
+			IPPU.TileCached[TILE_2BIT_EVEN][((address >> 4) - 1) & (MAX_2BIT_TILES - 1)] = FALSE;
+			IPPU.TileCached[TILE_2BIT_ODD] [address >> 4] = FALSE;
+			IPPU.TileCached[TILE_2BIT_ODD] [((address >> 4) - 1) & (MAX_2BIT_TILES - 1)] = FALSE;
+			IPPU.TileCached[TILE_4BIT_EVEN][address >> 5] = FALSE;
+			IPPU.TileCached[TILE_4BIT_EVEN][((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+			IPPU.TileCached[TILE_4BIT_ODD] [address >> 5] = FALSE;
+			IPPU.TileCached[TILE_4BIT_ODD] [((address >> 5) - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+		}
 	}
+}
 
-	/* Bottom-up walk over the original PPU.ScreenHeight rows. */
-	for (y = (int32)PPU.ScreenHeight - 1; y >= 0; y--)
+// Mode 7 vertical-2x post-pass (Settings.Mode7HiresVertical). Expands a
+// frame of height rows, laid out like GFX.Screen, to twice the height in
+// place: rows from m7_start on are interpolated, the HUD rows above them
+// are repeated. The port runs it when S9xDeinitUpdate is handed a frame with
+// IPPU.M7VertStartY set, on the emulation thread or off it. Returns the
+// frame's new height.
+int S9xMode7VertResample (uint16 *screen, uint32 ppl, uint32 width, uint32 height, int32 m7_start)
+{
+	int32 y;
+
+	if (m7_start < 0)
+		return (height);
+
+	/* Backstop for any future path that arms the pass with a taller frame:
+	   refuse rather than write past the buffer. The usable region below
+	   GFX.Screen is (MAX_SNES_HEIGHT + 32) rows, the 64 rows of slack in
+	   its buffer less the 32-row offset GFX.Screen sits at. */
+	if (height * 2 > MAX_SNES_HEIGHT + 32)
+		return (height);
+
+	/* Bottom-up walk over the original rows. */
+	for (y = (int32)height - 1; y >= 0; y--)
 	{
-		uint16 *src      = GFX.Screen + (uint32)y * ppl;
-		uint16 *dst_even = GFX.Screen + (uint32)(2 * y    ) * ppl;
-		uint16 *dst_odd  = GFX.Screen + (uint32)(2 * y + 1) * ppl;
+		uint16 *src      = screen + (uint32)y * ppl;
+		uint16 *dst_even = screen + (uint32)(2 * y    ) * ppl;
+		uint16 *dst_odd  = screen + (uint32)(2 * y + 1) * ppl;
 
-		if (y >= m7_start && y + 1 < (int32)PPU.ScreenHeight)
+		if (y >= m7_start && y + 1 < (int32)height)
 		{
 			/* M7 plane: bilinear-Y. dst_even = src; dst_odd =
 			 * (src + src_below) / 2 per channel. RGB565 is unpacked
 			 * with a fast trick: average packed values by taking the
 			 * low bits separately to avoid cross-channel carry. */
-			uint16 *src_below = GFX.Screen + (uint32)(y + 1) * ppl;
+			uint16 *src_below = screen + (uint32)(y + 1) * ppl;
 			uint32 x;
 			for (x = 0; x < width; x++)
 			{
@@ -1845,7 +1867,7 @@ void S9xMode7VertResample (void)
 		}
 	}
 
-	IPPU.RenderedScreenHeight = PPU.ScreenHeight * 2;
+	return (height * 2);
 }
 
 void S9xSoftResetPPU (void)
@@ -1983,15 +2005,11 @@ void S9xSoftResetPPU (void)
 
 	for (int c = 0; c < 2; c++)
 		memset(&IPPU.Clip[c], 0, sizeof(struct ClipData));
+	S9xInvalidateClipWindows();
 	IPPU.ColorsChanged = TRUE;
 	IPPU.OBJChanged = TRUE;
-	memset(IPPU.TileCached[TILE_2BIT], 0, MAX_2BIT_TILES);
-	memset(IPPU.TileCached[TILE_4BIT], 0, MAX_4BIT_TILES);
-	memset(IPPU.TileCached[TILE_8BIT], 0, MAX_8BIT_TILES);
-	memset(IPPU.TileCached[TILE_2BIT_EVEN], 0, MAX_2BIT_TILES);
-	memset(IPPU.TileCached[TILE_2BIT_ODD], 0,  MAX_2BIT_TILES);
-	memset(IPPU.TileCached[TILE_4BIT_EVEN], 0, MAX_4BIT_TILES);
-	memset(IPPU.TileCached[TILE_4BIT_ODD], 0,  MAX_4BIT_TILES);
+	IPPU.ScreenDirty = TRUE;
+	S9xInvalidateTileCache();
 	PPU.VRAMReadBuffer = 0; // XXX: FIXME: anything better?
 	GFX.DoInterlace = 0;
 	IPPU.Interlace = FALSE;
@@ -45,9 +45,12 @@ struct InternalPPU
 {
 	struct ClipData Clip[2][6];
 	bool8	ColorsChanged;
-	bool8	OBJChanged;
+	bool8	OBJChanged;			// every sprite needs re-evaluating (size, rotation, ...)
+	uint32	OBJDirty[4];		// per-sprite bits from $2104 writes, see SetupOBJ
+	bool8	ScreenDirty;		// VRAM/CGRAM/OAM, or anything else not compared at frame end, changed since the last displayed frame
 	uint8	*TileCache[7];
 	uint8	*TileCached[7];
+	bool8	Mode7Cached[0x10000 >> 8];	// per 256 bytes of VRAM: the Mode 7 planes (tile.c) hold them
 	bool8	Interlace;
 	bool8	InterlaceOBJ;
 	bool8	PseudoHires;
@@ -208,11 +211,13 @@ struct SPPU
 };
 
 extern uint16				SignExtend[2];
-extern struct SPPU			PPU;
-extern struct InternalPPU	IPPU;
+extern S9X_TLS struct SPPU			PPU;
+extern S9X_TLS struct InternalPPU	IPPU;
 
 void S9xResetPPU (void);
 void S9xResetPPUFast (void);
+void S9xInvalidateTileCache (void);
+void S9xInvalidateVRAMChanges (const uint8 *);
 void S9xSoftResetPPU (void);
 void S9xSetPPU (uint8, uint16);
 uint8 S9xGetPPU (uint16);
@@ -228,6 +233,7 @@ void S9xDoAutoJoypad (void);
 #include "gfx.h"
 #ifdef __cplusplus
 #include "memmap.h"
+#include "dirty.h"
 extern "C" {
 #endif
 
@@ -238,7 +244,7 @@ typedef struct
 	uint8	_5A22;
 }	SnesModel;
 
-extern SnesModel	*Model;
+extern S9X_TLS SnesModel	*Model;
 extern SnesModel	M1SNES;
 extern SnesModel	M2SNES;
 
@@ -247,7 +253,7 @@ extern SnesModel	M2SNES;
 #define MAX_5A22_VERSION	0x02
 
 void S9xUpdateScreen (void);
-void S9xMode7VertResample (void);
+int S9xMode7VertResample (uint16 *, uint32, uint32, uint32, int32);
 #ifdef __cplusplus
 }	/* extern "C" */
 /* Inline register helpers below are C++ side only. */
@@ -270,6 +276,14 @@ static inline void S9xUpdateVRAMReadBuffer()
 		PPU.VRAMReadBuffer = READ_WORD(Memory.VRAM + ((PPU.VMA.Address << 1) & 0xffff));
 }
 
+// Only Y, size, X and V-flip decide which lines a sprite lands on and
+// with what tile row; name, palette, priority and H-flip are read
+// straight from PPU.OBJ at draw time.
+static inline void MARK_OBJ_DIRTY (int S)
+{
+	IPPU.OBJDirty[S >> 5] |= 1u << (S & 31);
+}
+
 static inline void REGISTER_2104 (uint8 Byte)
 {
 	if (!(PPU.OAMFlip & 1))
@@ -284,8 +298,13 @@ static inline void REGISTER_2104 (uint8 Byte)
 		if (Byte != PPU.OAMData[addr])
 		{
 			FLUSH_REDRAW();
+			IPPU.ScreenDirty = TRUE;
+			uint8 diff = Byte ^ PPU.OAMData[addr];
 			PPU.OAMData[addr] = Byte;
-			IPPU.OBJChanged = TRUE;
+
+			for (int i = 0; i < 4; i++)
+				if (diff & (3 << (i * 2)))
+					MARK_OBJ_DIRTY((addr & 0x1f) * 4 + i);
 
 			// X position high bit, and sprite size (x4)
 			struct SOBJ *pObj = &PPU.OBJ[(addr & 0x1f) * 4];
@@ -311,11 +330,14 @@ static inline void REGISTER_2104 (uint8 Byte)
 		if (lowbyte != PPU.OAMData[addr] || highbyte != PPU.OAMData[addr + 1])
 		{
 			FLUSH_REDRAW();
+			IPPU.ScreenDirty = TRUE;
 			PPU.OAMData[addr] = lowbyte;
 			PPU.OAMData[addr + 1] = highbyte;
-			IPPU.OBJChanged = TRUE;
 			if (addr & 2)
 			{
+				if ((highbyte >> 7) != PPU.OBJ[PPU.OAMAddr >> 1].VFlip)
+					MARK_OBJ_DIRTY(PPU.OAMAddr >> 1);
+
 				// Tile
 				PPU.OBJ[addr = PPU.OAMAddr >> 1].Name = PPU.OAMWriteRegister & 0x1ff;
 				// priority, h and v flip.
@@ -326,6 +348,8 @@ static inline void REGISTER_2104 (uint8 Byte)
 			}
 			else
 			{
+				MARK_OBJ_DIRTY(PPU.OAMAddr >> 1);
+
 				// X position (low)
 				PPU.OBJ[addr = PPU.OAMAddr >> 1].HPos &= 0xff00;
 				PPU.OBJ[addr].HPos |= lowbyte;
@@ -374,6 +398,20 @@ static inline void REGISTER_2104 (uint8 Byte)
 	}
 #endif
 
+// Only a write that changes the byte sets IPPU.ScreenDirty, so a
+// game re-uploading the same tiles every frame can still produce dupes.
+static inline void STORE_VRAM (uint32 address, uint8 Byte)
+{
+	if (Memory.VRAM[address] != Byte)
+	{
+		IPPU.ScreenDirty = TRUE;
+		IPPU.Mode7Cached[address >> 8] = FALSE;
+		S9xDirtyVRAM(address);
+	}
+
+	Memory.VRAM[address] = Byte;
+}
+
 static inline void REGISTER_2118 (uint8 Byte)
 {
 	CHECK_INBLANK();
@@ -384,10 +422,10 @@ static inline void REGISTER_2118 (uint8 Byte)
 	{
 		uint32 rem = PPU.VMA.Address & PPU.VMA.Mask1;
 		address = (((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) & 0xffff;
-		Memory.VRAM[address] = Byte;
+		STORE_VRAM(address, Byte);
 	}
 	else
-		Memory.VRAM[address = (PPU.VMA.Address << 1) & 0xffff] = Byte;
+		STORE_VRAM(address = (PPU.VMA.Address << 1) & 0xffff, Byte);
 
 	IPPU.TileCached[TILE_2BIT][address >> 4] = FALSE;
 	IPPU.TileCached[TILE_4BIT][address >> 5] = FALSE;
@@ -418,7 +456,7 @@ static inline void REGISTER_2118_tile (uint8 Byte)
 	uint32 rem = PPU.VMA.Address & PPU.VMA.Mask1;
 	uint32 address = (((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) & 0xffff;
 
-	Memory.VRAM[address] = Byte;
+	STORE_VRAM(address, Byte);
 
 	IPPU.TileCached[TILE_2BIT][address >> 4] = FALSE;
 	IPPU.TileCached[TILE_4BIT][address >> 5] = FALSE;
@@ -442,7 +480,7 @@ static inline void REGISTER_2118_linear (uint8 Byte)
 
 	uint32	address;
 
-	Memory.VRAM[address = (PPU.VMA.Address << 1) & 0xffff] = Byte;
+	STORE_VRAM(address = (PPU.VMA.Address << 1) & 0xffff, Byte);
 
 	IPPU.TileCached[TILE_2BIT][address >> 4] = FALSE;
 	IPPU.TileCached[TILE_4BIT][address >> 5] = FALSE;
@@ -491,10 +529,10 @@ static inline void REGISTER_2119 (uint8 Byte)
 	{
 		uint32 rem = PPU.VMA.Address & PPU.VMA.Mask1;
 		address = ((((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) + 1) & 0xffff;
-		Memory.VRAM[address] = Byte;
+		STORE_VRAM(address, Byte);
 	}
 	else
-		Memory.VRAM[address = ((PPU.VMA.Address << 1) + 1) & 0xffff] = Byte;
+		STORE_VRAM(address = ((PPU.VMA.Address << 1) + 1) & 0xffff, Byte);
 
 	IPPU.TileCached[TILE_2BIT][address >> 4] = FALSE;
 	IPPU.TileCached[TILE_4BIT][address >> 5] = FALSE;
@@ -525,7 +563,7 @@ static inline void REGISTER_2119_tile (uint8 Byte)
 	uint32 rem = PPU.VMA.Address & PPU.VMA.Mask1;
 	uint32 address = ((((PPU.VMA.Address & ~PPU.VMA.Mask1) + (rem >> PPU.VMA.Shift) + ((rem & (PPU.VMA.FullGraphicCount - 1)) << 3)) << 1) + 1) & 0xffff;
 
-	Memory.VRAM[address] = Byte;
+	STORE_VRAM(address, Byte);
 
 	IPPU.TileCached[TILE_2BIT][address >> 4] = FALSE;
 	IPPU.TileCached[TILE_4BIT][address >> 5] = FALSE;
@@ -549,7 +587,7 @@ static inline void REGISTER_2119_linear (uint8 Byte)
 
 	uint32	address;
 
-	Memory.VRAM[address = ((PPU.VMA.Address << 1) + 1) & 0xffff] = Byte;
+	STORE_VRAM(address = ((PPU.VMA.Address << 1) + 1) & 0xffff, Byte);
 
 	IPPU.TileCached[TILE_2BIT][address >> 4] = FALSE;
 	IPPU.TileCached[TILE_4BIT][address >> 5] = FALSE;
@@ -576,6 +614,7 @@ static inline void REGISTER_2122 (uint8 Byte)
 			FLUSH_REDRAW();
 			PPU.CGDATA[PPU.CGADD] = (Byte & 0x7f) << 8 | PPU.CGSavedByte;
 			IPPU.ColorsChanged = TRUE;
+			IPPU.ScreenDirty = TRUE;
 			IPPU.Red[PPU.CGADD] = IPPU.XB[PPU.CGSavedByte & 0x1f];
 			IPPU.Blue[PPU.CGADD] = IPPU.XB[(Byte >> 2) & 0x1f];
 			IPPU.Green[PPU.CGADD] = IPPU.XB[(PPU.CGDATA[PPU.CGADD] >> 5) & 0x1f];
@@ -594,6 +633,7 @@ static inline void REGISTER_2122 (uint8 Byte)
 
 static inline void REGISTER_2180 (uint8 Byte)
 {
+	S9xDirtyRAM(PPU.WRAM);
 	Memory.RAM[PPU.WRAM++] = Byte;
 	PPU.WRAM &= 0x1ffff;
 }
@@ -0,0 +1,414 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+/* Rewind history.
+
+   The newest pushed state is kept whole, as a full snapshot. Every state
+   before it is kept as the delta that leads back to it from the state after
+   it: the records of that later state's delta snapshot, with each byte XORed
+   against the byte it replaced. XORing an entry into the snapshot it was
+   taken against therefore steps the snapshot back one frame. Every record is
+   mostly zeros, and a small LZ77 coder squeezes those runs down to a few
+   bytes. The newest state serves as the only keyframe. Because entries
+   lead backwards from it, the oldest can be dropped whenever the ring needs
+   the room, without anything being re-keyed.
+
+   The entries live in one byte ring of the configured size, each stored in
+   a single contiguous piece. A small index records where each one starts. */
+
+#include <stdlib.h>
+#include "snes9x.h"
+#include "memmap.h"
+#include "snapshot.h"
+#include "rewind.h"
+
+struct SRewindEntry
+{
+	uint32	offset;
+	uint32	size;
+};
+
+static S9X_TLS uint8		*Ring = NULL;
+static S9X_TLS uint32		RingSize = 0;
+static S9X_TLS SRewindEntry	*Entries = NULL;
+static S9X_TLS uint32		EntryCap = 0, EntryFirst = 0, EntryCount = 0;
+
+static S9X_TLS uint8		*State = NULL;		// newest pushed state, whole
+static S9X_TLS uint32		StateSize = 0;
+static S9X_TLS bool8		StateValid = FALSE;
+static S9X_TLS uint32		Baseline;			// delta serial State was taken at
+static S9X_TLS uint8		*Delta = NULL;		// one delta, raw
+static S9X_TLS uint32		DeltaSize = 0;
+static S9X_TLS uint8		*Packed = NULL;		// one delta, compressed
+static S9X_TLS uint32		PackedSize = 0;
+
+// LZ77 in the shape of LZ4's block format. A sequence is a token, whose high
+// nibble is the literal count and low nibble the match length less
+// LZ_MIN_MATCH; either runs on in 255-valued bytes when it reads 15. Then come
+// the literals, a 16-bit little-endian distance back and the match length
+// bytes. The last sequence stops after its literals.
+
+#define LZ_MIN_MATCH	4
+#define LZ_MAX_DISTANCE	0xffff
+#define LZ_HASH_BITS	12
+#define LZ_BOUND(n)		((n) + (n) / 255 + 16)
+
+static inline uint32 LZHash (const uint8 *p)
+{
+	return ((READ_DWORD(p) * 2654435761u) >> (32 - LZ_HASH_BITS));
+}
+
+static uint8 * LZPutLength (uint8 *op, uint32 len)
+{
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = (uint8) len;
+
+	return (op);
+}
+
+static uint8 * LZPutSequence (uint8 *op, const uint8 *lit, uint32 litLen, uint32 distance, uint32 matchLen)
+{
+	uint8	*token = op++;
+
+	*token = (uint8) ((litLen < 15 ? litLen : 15) << 4);
+	if (litLen >= 15)
+		op = LZPutLength(op, litLen - 15);
+
+	memcpy(op, lit, litLen);
+	op += litLen;
+
+	if (matchLen)
+	{
+		matchLen -= LZ_MIN_MATCH;
+		*token |= (uint8) (matchLen < 15 ? matchLen : 15);
+		*op++ = (uint8) distance;
+		*op++ = (uint8) (distance >> 8);
+		if (matchLen >= 15)
+			op = LZPutLength(op, matchLen - 15);
+	}
+
+	return (op);
+}
+
+// dst must hold LZ_BOUND(len) bytes.
+static uint32 LZEncode (const uint8 *src, uint32 len, uint8 *dst)
+{
+	static S9X_TLS uint32	table[1 << LZ_HASH_BITS];
+	const uint8		*ip = src, *anchor = src, *end = src + len;
+	uint8			*op = dst;
+
+	memset(table, 0, sizeof(table));
+
+	while (end - ip >= LZ_MIN_MATCH)
+	{
+		uint32		h   = LZHash(ip);
+		const uint8	*ref = src + table[h];
+
+		table[h] = (uint32) (ip - src);
+
+		if (ref < ip && ip - ref <= LZ_MAX_DISTANCE && !memcmp(ref, ip, LZ_MIN_MATCH))
+		{
+			uint32	m = LZ_MIN_MATCH;
+			while (ip + m < end && ref[m] == ip[m])
+				m++;
+
+			op = LZPutSequence(op, anchor, (uint32) (ip - anchor), (uint32) (ip - ref), m);
+			ip += m;
+			anchor = ip;
+		}
+		else
+			ip++;
+	}
+
+	op = LZPutSequence(op, anchor, (uint32) (end - anchor), 0, 0);
+
+	return ((uint32) (op - dst));
+}
+
+static bool8 LZGetLength (const uint8 **ip, const uint8 *end, uint32 *len)
+{
+	uint8	b;
+
+	do
+	{
+		if (*ip >= end)
+			return (FALSE);
+		b = *(*ip)++;
+		*len += b;
+	}
+	while (b == 255);
+
+	return (TRUE);
+}
+
+static bool8 LZDecode (const uint8 *src, uint32 len, uint8 *dst, uint32 cap, uint32 *outLen)
+{
+	const uint8	*ip = src, *end = src + len;
+	uint8		*op = dst, *oend = dst + cap;
+
+	for (;;)
+	{
+		if (ip >= end)
+			return (FALSE);
+
+		uint32	token = *ip++;
+		uint32	lit = token >> 4;
+
+		if (lit == 15 && !LZGetLength(&ip, end, &lit))
+			return (FALSE);
+		if (lit > (uint32) (end - ip) || lit > (uint32) (oend - op))
+			return (FALSE);
+
+		memcpy(op, ip, lit);
+		op += lit;
+		ip += lit;
+
+		if (ip == end)
+			break;
+		if (end - ip < 2)
+			return (FALSE);
+
+		uint32	distance = ip[0] | (ip[1] << 8);
+		uint32	m = token & 15;
+		ip += 2;
+
+		if (m == 15 && !LZGetLength(&ip, end, &m))
+			return (FALSE);
+		m += LZ_MIN_MATCH;
+
+		if (distance == 0 || distance > (uint32) (op - dst) || m > (uint32) (oend - op))
+			return (FALSE);
+
+		// Byte by byte: the match may overlap what it is producing.
+		const uint8	*ref = op - distance;
+		while (m--)
+			*op++ = *ref++;
+	}
+
+	*outLen = (uint32) (op - dst);
+
+	return (TRUE);
+}
+
+// Walks the records of a delta snapshot (see S9xFreezeDelta) against State. Going
+// forward, State takes each record's bytes and the record is left holding
+// their XOR with what they replaced; going back, State is XORed with them.
+static bool8 XorRecords (uint8 *delta, uint32 len, bool8 forward)
+{
+	for (uint32 pos = DELTA_HEADER_SIZE; pos < len; )
+	{
+		if (len - pos < 8)
+			return (FALSE);
+
+		uint32	offset = READ_DWORD(delta + pos);
+		uint32	size   = READ_DWORD(delta + pos + 4);
+		pos += 8;
+
+		if (size > len - pos || offset > StateSize || size > StateSize - offset)
+			return (FALSE);
+
+		uint8	*d = delta + pos, *s = State + offset;
+
+		if (forward)
+		{
+			for (uint32 i = 0; i < size; i++)
+			{
+				d[i] ^= s[i];
+				s[i] ^= d[i];
+			}
+		}
+		else
+		{
+			for (uint32 i = 0; i < size; i++)
+				s[i] ^= d[i];
+		}
+
+		pos += size;
+	}
+
+	return (TRUE);
+}
+
+static void DropOldest (void)
+{
+	EntryFirst = (EntryFirst + 1) % EntryCap;
+	EntryCount--;
+}
+
+static void StoreEntry (const uint8 *data, uint32 size)
+{
+	if (size > RingSize)
+	{
+		// Too big to keep: nothing older can be reached without it.
+		EntryCount = 0;
+		return;
+	}
+
+	uint32	newestEnd = 0;
+	if (EntryCount)
+	{
+		SRewindEntry	*e = &Entries[(EntryFirst + EntryCount - 1) % EntryCap];
+		newestEnd = e->offset + e->size;
+	}
+
+	uint32	pos = newestEnd;
+	bool8	wrapped = FALSE;
+	if (RingSize - pos < size)
+	{
+		pos = 0;
+		wrapped = TRUE;
+	}
+
+	// The oldest entries are the ones laid out after the newest, then the
+	// ones from the start of the ring on; give up as many as overlap.
+	while (EntryCount)
+	{
+		SRewindEntry	*o = &Entries[EntryFirst];
+
+		if (EntryCount == EntryCap ||
+			(wrapped && o->offset >= newestEnd) ||
+			(o->offset < pos + size && pos < o->offset + o->size))
+			DropOldest();
+		else
+			break;
+	}
+
+	memcpy(Ring + pos, data, size);
+
+	SRewindEntry	*e = &Entries[(EntryFirst + EntryCount) % EntryCap];
+	e->offset = pos;
+	e->size   = size;
+	EntryCount++;
+}
+
+static bool8 Rebase (void)
+{
+	if (!State)
+	{
+		StateSize  = S9xFreezeSize();
+		DeltaSize  = StateSize + StateSize / 16 + 4096;
+		PackedSize = LZ_BOUND(DeltaSize);
+		State  = (uint8 *) malloc(StateSize);
+		Delta  = (uint8 *) malloc(DeltaSize);
+		Packed = (uint8 *) malloc(PackedSize);
+
+		if (!State || !Delta || !Packed)
+		{
+			S9xRewindReset();
+			return (FALSE);
+		}
+	}
+
+	EntryCount = 0;
+	Baseline = S9xDeltaBaseline();
+	S9xFreezeGameMem(State, StateSize);
+	StateValid = TRUE;
+
+	return (TRUE);
+}
+
+bool8 S9xRewindInit (uint32 budget)
+{
+	S9xRewindDeinit();
+
+	if (!budget)
+		return (TRUE);
+
+	// Entries come to a few hundred bytes at the least.
+	EntryCap = budget / 256 + 1;
+	Entries  = (SRewindEntry *) malloc(EntryCap * sizeof(SRewindEntry));
+	Ring     = (uint8 *) malloc(budget);
+
+	if (!Entries || !Ring)
+	{
+		S9xRewindDeinit();
+		return (FALSE);
+	}
+
+	RingSize = budget;
+
+	return (TRUE);
+}
+
+void S9xRewindDeinit (void)
+{
+	S9xRewindReset();
+
+	free(Ring);
+	free(Entries);
+	Ring = NULL;
+	Entries = NULL;
+	RingSize = EntryCap = 0;
+}
+
+void S9xRewindReset (void)
+{
+	free(State);
+	free(Delta);
+	free(Packed);
+	State = Delta = Packed = NULL;
+	StateSize = DeltaSize = PackedSize = 0;
+	StateValid = FALSE;
+
+	EntryFirst = EntryCount = 0;
+}
+
+void S9xRewindPush (void)
+{
+	if (!Ring)
+		return;
+
+	if (!StateValid)
+	{
+		Rebase();
+		return;
+	}
+
+	uint32	next;
+	uint32	len = S9xFreezeDelta(Delta, DeltaSize, Baseline, &next);
+
+	if (!len || !XorRecords(Delta, len, TRUE))
+	{
+		Rebase();
+		return;
+	}
+
+	Baseline = next;
+	StoreEntry(Packed, LZEncode(Delta, len, Packed));
+}
+
+bool8 S9xRewindStep (void)
+{
+	if (!EntryCount || !StateValid)
+		return (FALSE);
+
+	SRewindEntry	*e = &Entries[(EntryFirst + EntryCount - 1) % EntryCap];
+	uint32			len;
+
+	EntryCount--;
+
+	if (!LZDecode(Ring + e->offset, e->size, Delta, DeltaSize, &len) || !XorRecords(Delta, len, FALSE))
+	{
+		StateValid = FALSE;
+		EntryCount = 0;
+		return (FALSE);
+	}
+
+	bool8	fast = Settings.FastSavestates;
+	Settings.FastSavestates = TRUE;
+	S9xUnfreezeGameMem(State, StateSize);
+	Settings.FastSavestates = fast;
+
+	Baseline = S9xDeltaBaseline();
+
+	return (TRUE);
+}
+
+uint32 S9xRewindDepth (void)
+{
+	return (EntryCount);
+}
@@ -0,0 +1,27 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+#ifndef _REWIND_H_
+#define _REWIND_H_
+
+#include "port.h"
+
+// In-core rewind history, built on delta snapshots.
+//
+// S9xRewindInit sets the memory the history may use, in bytes, and drops
+// what it held; 0 turns rewind off. Call S9xRewindPush once per emulated
+// frame. S9xRewindStep loads the state pushed before the newest one and
+// makes it the newest, returning FALSE once the history is used up.
+// S9xRewindReset forgets everything, and must be called when a different
+// game is loaded.
+bool8 S9xRewindInit (uint32);
+void S9xRewindDeinit (void);
+void S9xRewindReset (void);
+void S9xRewindPush (void);
+bool8 S9xRewindStep (void);
+uint32 S9xRewindDepth (void);
+
+#endif
@@ -10,12 +10,12 @@
 extern "C" {
 #endif
 
-extern uint8_t  *BridgeSRAM;
-extern uint8_t  *BridgeROM;
-extern uint8_t  *BridgeFillRAM;
-extern uint8_t **BridgeMap;
-extern uint32_t  BridgeSRAMMask;
-extern uint32_t  BridgeCalculatedSize;
+extern S9X_TLS uint8_t  *BridgeSRAM;
+extern S9X_TLS uint8_t  *BridgeROM;
+extern S9X_TLS uint8_t  *BridgeFillRAM;
+extern S9X_TLS uint8_t **BridgeMap;
+extern S9X_TLS uint32_t  BridgeSRAMMask;
+extern S9X_TLS uint32_t  BridgeCalculatedSize;
 
 #ifdef __cplusplus
 }
@@ -8,7 +8,7 @@
 #include "sa1hw.h"
 #include "memmap.h"
 
-uint8	SA1OpenBus;
+S9X_TLS uint8	SA1OpenBus;
 
 static void S9xSA1SetBWRAMMemMap (uint8);
 static void S9xSetSA1MemMap (uint32, uint8);
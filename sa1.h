@@ -72,9 +72,9 @@ struct SSA1
 #define SA1ClearFlags(f)	(SA1Registers.P.W &= ~(f))
 #define SA1CheckFlag(f)		(SA1Registers.PL & (f))
 
-extern struct SSA1Registers	SA1Registers;
-extern struct SSA1			SA1;
-extern uint8				SA1OpenBus;
+extern S9X_TLS struct SSA1Registers	SA1Registers;
+extern S9X_TLS struct SSA1			SA1;
+extern S9X_TLS uint8				SA1OpenBus;
 extern struct SOpcodes		S9xSA1OpcodesM1X1[256];
 extern struct SOpcodes		S9xSA1OpcodesM1X0[256];
 extern struct SOpcodes		S9xSA1OpcodesM0X1[256];
@@ -11,9 +11,9 @@
 
 #include "sa1hw.h"
 
-uint8_t  *SA1FillRAM   = 0;
-uint8_t  *SA1BWRAMBase = 0;
-uint32_t  SA1BWRAMMask = 0;
+S9X_TLS uint8_t  *SA1FillRAM   = 0;
+S9X_TLS uint8_t  *SA1BWRAMBase = 0;
+S9X_TLS uint32_t  SA1BWRAMMask = 0;
 
 /* BW-RAM write protection.
  *
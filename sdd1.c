@@ -259,16 +259,16 @@ void S9xSDD1PostLoadState (void)
 		S9xSetSDD1MemoryMap(i, BridgeFillRAM[0x4804 + i]);
 }
 
-static int valid_bits;
-static uint16_t in_stream;
-static uint8_t *in_buf;
-static uint8_t bit_ctr[8];
-static uint8_t context_states[32];
-static int context_MPS[32];
-static int bitplane_type;
-static int high_context_bits;
-static int low_context_bits;
-static int prev_bits[8];
+static S9X_TLS int valid_bits;
+static S9X_TLS uint16_t in_stream;
+static S9X_TLS uint8_t *in_buf;
+static S9X_TLS uint8_t bit_ctr[8];
+static S9X_TLS uint8_t context_states[32];
+static S9X_TLS int context_MPS[32];
+static S9X_TLS int bitplane_type;
+static S9X_TLS int high_context_bits;
+static S9X_TLS int low_context_bits;
+static S9X_TLS int prev_bits[8];
 
 static const struct
 {
@@ -184,8 +184,8 @@
 #include "s9xbridge.h"
 #include "seta.h"
 
-uint8_t	(*GetSETA) (uint32_t)        = &S9xGetST010;
-void	(*SetSETA) (uint32_t, uint8_t) = &S9xSetST010;
+S9X_TLS uint8_t	(*GetSETA) (uint32_t)        = &S9xGetST010;
+S9X_TLS void	(*SetSETA) (uint32_t, uint8_t) = &S9xSetST010;
 
 
 uint8_t S9xGetSetaDSP (uint32_t Address)
@@ -903,7 +903,7 @@ void S9xSetST010 (uint32_t Address, uint8_t Byte)
  Seta 011
 ***********************************************************************************/
 
-static uint8_t	board[9][9];	/* shougi playboard*/
+static S9X_TLS uint8_t	board[9][9];	/* shougi playboard*/
 
 uint8_t S9xGetST011 (uint32_t Address)
 {
@@ -921,7 +921,7 @@ uint8_t S9xGetST011 (uint32_t Address)
 
 void S9xSetST011 (uint32_t Address, uint8_t Byte)
 {
-	static uint8_t	reset   = FALSE;
+	static S9X_TLS uint8_t	reset   = FALSE;
 	uint16_t		address = (uint16_t) Address & 0xFFFF;
 
 	if (!reset)
@@ -1053,7 +1053,7 @@ uint8_t S9xGetST018 (uint32_t Address)
 
 void S9xSetST018 (uint8_t Byte, uint32_t Address)
 {
-	static uint8_t	reset   = FALSE;
+	static S9X_TLS uint8_t	reset   = FALSE;
 	uint16_t		address = (uint16_t) Address & 0xFFFF;
 
 	if (!reset)
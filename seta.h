@@ -227,9 +227,9 @@ struct SST018
 	uint8_t	output[512];
 };
 
-extern struct SST010	ST010;
-extern struct SST011	ST011;
-extern struct SST018	ST018;
+extern S9X_TLS struct SST010	ST010;
+extern S9X_TLS struct SST011	ST011;
+extern S9X_TLS struct SST018	ST018;
 
 uint8_t S9xGetST010 (uint32_t Address);
 void S9xSetST010 (uint32_t Address, uint8_t Byte);
@@ -240,8 +240,8 @@ void S9xSetST018 (uint8_t Byte, uint32_t Address);
 uint8_t S9xGetSetaDSP (uint32_t Address);
 void S9xSetSetaDSP (uint8_t Byte, uint32_t Address);
 
-extern uint8_t (*GetSETA) (uint32_t Address);
-extern void (*SetSETA) (uint32_t Address, uint8_t Byte);
+extern S9X_TLS uint8_t (*GetSETA) (uint32_t Address);
+extern S9X_TLS void (*SetSETA) (uint32_t Address, uint8_t Byte);
 
 #ifdef __cplusplus
 }
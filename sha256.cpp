@@ -17,6 +17,19 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Hardware kernels: the SHA extensions on x86, picked at run time, since
+   no baseline x86 target has them; the ARMv8 SHA2 instructions wherever
+   the build targets them. Both give the same digests as the portable code,
+   which the others fall back to. */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SHA256_HAVE_SHANI
+#include <immintrin.h>
+#include <cpuid.h>
+#elif (defined(__aarch64__) || defined(__arm__)) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+#define SHA256_HAVE_ARMV8
+#include <arm_neon.h>
+#endif
+
 /****************************** MACROS ******************************/
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
 #define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
@@ -53,45 +66,161 @@ static const WORD k[64] = {
 };
 
 /*********************** FUNCTION DEFINITIONS ***********************/
-void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+typedef void (*sha256_blocks_fn)(WORD state[8], const BYTE data[], size_t blocks);
+
+static void sha256_blocks_c(WORD state[8], const BYTE data[], size_t blocks)
 {
 	WORD a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-	for (i = 0, j = 0; i < 16; ++i, j += 4)
-		m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-	for ( ; i < 64; ++i)
-		m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-	a = ctx->state[0];
-	b = ctx->state[1];
-	c = ctx->state[2];
-	d = ctx->state[3];
-	e = ctx->state[4];
-	f = ctx->state[5];
-	g = ctx->state[6];
-	h = ctx->state[7];
-
-	for (i = 0; i < 64; ++i) {
-		t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-		t2 = EP0(a) + MAJ(a,b,c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + t1;
-		d = c;
-		c = b;
-		b = a;
-		a = t1 + t2;
+	for ( ; blocks; --blocks, data += 64) {
+		for (i = 0, j = 0; i < 16; ++i, j += 4)
+			m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+		for ( ; i < 64; ++i)
+			m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 64; ++i) {
+			t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
+			t2 = EP0(a) + MAJ(a,b,c);
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
+	}
+}
+
+#ifdef SHA256_HAVE_SHANI
+/* SHA256RNDS2 works on the state split as ABEF and CDGH, two rounds at a
+   time; each group of four message words is expanded into the group four
+   ahead of it as it is used. */
+__attribute__((target("sha,sse4.1")))
+static void sha256_blocks_shani(WORD state[8], const BYTE data[], size_t blocks)
+{
+	const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i abef, cdgh, abef_save, cdgh_save, msg[4], wk, t;
+	int i;
+
+	t    = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[0]), 0xb1);	/* CDAB */
+	cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[4]), 0x1b);	/* EFGH */
+	abef = _mm_alignr_epi8(t, cdgh, 8);
+	cdgh = _mm_blend_epi16(cdgh, t, 0xf0);
+
+	for ( ; blocks; --blocks, data += 64) {
+		abef_save = abef;
+		cdgh_save = cdgh;
+
+		for (i = 0; i < 4; ++i)
+			msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (data + 16 * i)), bswap);
+
+		for (i = 0; i < 16; ++i) {
+			wk = _mm_add_epi32(msg[i & 3], _mm_loadu_si128((const __m128i *) &k[4 * i]));
+
+			if (i < 12) {
+				t = _mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]);
+				t = _mm_add_epi32(t, _mm_alignr_epi8(msg[(i + 3) & 3], msg[(i + 2) & 3], 4));
+				msg[i & 3] = _mm_sha256msg2_epu32(t, msg[(i + 3) & 3]);
+			}
+
+			cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+			abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0e));
+		}
+
+		abef = _mm_add_epi32(abef, abef_save);
+		cdgh = _mm_add_epi32(cdgh, cdgh_save);
 	}
 
-	ctx->state[0] += a;
-	ctx->state[1] += b;
-	ctx->state[2] += c;
-	ctx->state[3] += d;
-	ctx->state[4] += e;
-	ctx->state[5] += f;
-	ctx->state[6] += g;
-	ctx->state[7] += h;
+	t    = _mm_shuffle_epi32(abef, 0x1b);	/* FEBA */
+	cdgh = _mm_shuffle_epi32(cdgh, 0xb1);	/* DCHG */
+	_mm_storeu_si128((__m128i *) &state[0], _mm_blend_epi16(t, cdgh, 0xf0));
+	_mm_storeu_si128((__m128i *) &state[4], _mm_alignr_epi8(cdgh, t, 8));
+}
+
+static int sha256_cpu_has_shani(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1) || !(ecx & bit_SSSE3))
+		return 0;
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+		return 0;
+
+	return (ebx >> 29) & 1;
+}
+#endif
+
+#ifdef SHA256_HAVE_ARMV8
+/* SHA256H/SHA256H2 take the state as ABCD and EFGH, four rounds at a time. */
+static void sha256_blocks_armv8(WORD state[8], const BYTE data[], size_t blocks)
+{
+	uint32x4_t abcd = vld1q_u32(&state[0]), efgh = vld1q_u32(&state[4]);
+	uint32x4_t abcd_save, efgh_save, msg[4], wk, t;
+	int i;
+
+	for ( ; blocks; --blocks, data += 64) {
+		abcd_save = abcd;
+		efgh_save = efgh;
+
+		for (i = 0; i < 4; ++i)
+			msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+
+		for (i = 0; i < 16; ++i) {
+			wk = vaddq_u32(msg[i & 3], vld1q_u32(&k[4 * i]));
+
+			if (i < 12)
+				msg[i & 3] = vsha256su1q_u32(vsha256su0q_u32(msg[i & 3], msg[(i + 1) & 3]), msg[(i + 2) & 3], msg[(i + 3) & 3]);
+
+			t    = abcd;
+			abcd = vsha256hq_u32(abcd, efgh, wk);
+			efgh = vsha256h2q_u32(efgh, t, wk);
+		}
+
+		abcd = vaddq_u32(abcd, abcd_save);
+		efgh = vaddq_u32(efgh, efgh_save);
+	}
+
+	vst1q_u32(&state[0], abcd);
+	vst1q_u32(&state[4], efgh);
+}
+#endif
+
+static sha256_blocks_fn sha256_select(void)
+{
+#if defined(SHA256_HAVE_SHANI)
+	if (sha256_cpu_has_shani())
+		return sha256_blocks_shani;
+#elif defined(SHA256_HAVE_ARMV8)
+	return sha256_blocks_armv8;
+#endif
+	return sha256_blocks_c;
+}
+
+static void sha256_blocks(WORD state[8], const BYTE data[], size_t blocks)
+{
+	static const sha256_blocks_fn fn = sha256_select();
+
+	fn(state, data, blocks);
 }
 
 void sha256_init(SHA256_CTX *ctx)
@@ -110,17 +239,35 @@ void sha256_init(SHA256_CTX *ctx)
 
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD i;
+	size_t n;
 
-	for (i = 0; i < len; ++i) {
-		ctx->data[ctx->datalen] = data[i];
-		ctx->datalen++;
-		if (ctx->datalen == 64) {
-			sha256_transform(ctx, ctx->data);
-			ctx->bitlen += 512;
-			ctx->datalen = 0;
-		}
+	/* Top up a partly filled block first; whole blocks are then hashed
+	   straight out of data, and only the tail is copied. */
+	if (ctx->datalen) {
+		n = 64 - ctx->datalen;
+		if (n > len)
+			n = len;
+		memcpy(ctx->data + ctx->datalen, data, n);
+		ctx->datalen += n;
+		data += n;
+		len -= n;
+		if (ctx->datalen < 64)
+			return;
+		sha256_blocks(ctx->state, ctx->data, 1);
+		ctx->bitlen += 512;
+		ctx->datalen = 0;
 	}
+
+	n = len / 64;
+	if (n) {
+		sha256_blocks(ctx->state, data, n);
+		ctx->bitlen += (uint64_t) n * 512;
+		data += n * 64;
+		len -= n * 64;
+	}
+
+	memcpy(ctx->data, data, len);
+	ctx->datalen = len;
 }
 
 void sha256_final(SHA256_CTX *ctx, BYTE hash[])
@@ -139,7 +286,7 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 		ctx->data[i++] = 0x80;
 		while (i < 64)
 			ctx->data[i++] = 0x00;
-		sha256_transform(ctx, ctx->data);
+		sha256_blocks(ctx->state, ctx->data, 1);
 		memset(ctx->data, 0, 56);
 	}
 
@@ -153,7 +300,7 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 	ctx->data[58] = ctx->bitlen >> 40;
 	ctx->data[57] = ctx->bitlen >> 48;
 	ctx->data[56] = ctx->bitlen >> 56;
-	sha256_transform(ctx, ctx->data);
+	sha256_blocks(ctx->state, ctx->data, 1);
 
 	/* Since this implementation uses little endian byte ordering and SHA uses big endian,
 	   reverse all the bytes when copying the final state to the output hash. */
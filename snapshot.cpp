@@ -16,6 +16,8 @@
 #include "bsflash.h"
 #include "snapshot.h"
 #include "bytestream.h"
+#include "dirty.h"
+#include "hash64.h"
 #include "controls.h"
 #include "display.h"
 #include "language.h"
@@ -158,7 +160,7 @@ struct SDMASnapshot
 	struct SDMA	dma[8];
 };
 
-static struct Obsolete
+static S9X_TLS struct Obsolete
 {
 	uint8	CPU_IRQActive;
 }	Obsolete;
@@ -1000,137 +1002,1007 @@ static int UnfreezeBlock (ByteStream *, const char *, uint8 *, int);
 static int UnfreezeBlockCopy (ByteStream *, const char *, uint8 **, int);
 static int UnfreezeStructCopy (ByteStream *, const char *, uint8 **, FreezeData *, int, int);
 static void UnfreezeStructFromCopy (void *, FreezeData *, int, uint8 *, int);
-static void FreezeBlock (ByteStream *, const char *, uint8 *, int);
-static void FreezeStruct (ByteStream *, const char *, void *, FreezeData *, int);
+static int FreezeSize (int, int);
 static bool CheckBlockName(ByteStream *stream, const char *name, int &len);
 static void SkipBlockWithName(ByteStream *stream, const char *name);
 
 
-uint32 S9xFreezeSize()
+// Staging for the parts of the state that are not kept in a struct of their
+// own, filled by PreSaveState and read back after a load.
+static S9X_TLS struct SDMASnapshot		DMASnap;
+static S9X_TLS struct SControlSnapshot	CtlSnap;
+static S9X_TLS uint8					APURegisters[SPC_REGISTER_BLOCK_SIZE];
+
+// What every kind of snapshot save does first: bring the state that lives
+// elsewhere into the structs and staging that get saved.
+static void PreSaveState (void)
 {
-    /* Sizing pass: no buffer, so the writes only advance the cursor. */
-    ByteStream stream;
-    bs_init(&stream, NULL, 0);
-    S9xFreezeToStream(&stream);
-    return (uint32) bs_pos(&stream);
+	for (int d = 0; d < 8; d++)
+		DMASnap.dma[d] = DMA[d];
+
+	S9xAPUSaveRegisters(APURegisters);
+	S9xControlPreSaveState(&CtlSnap);
+	Timings.InterlaceField = S9xInterlaceField();
+
+	if (Settings.SuperFX)
+		GSU.avRegAddr = (uint8 *) &GSU.avReg;
+
+	if (Settings.SA1)
+		S9xSA1PackStatus();
+
+	if (Settings.SPC7110)
+		S9xSPC7110PreSaveState();
+
+	if (Settings.SRTC)
+		S9xSRTCPreSaveState();
+
+	if (Settings.MSU1)
+		S9xMSU1PreSaveState();
 }
 
-bool8 S9xFreezeGameMem (uint8 *buf, uint32 bufSize)
+// What every kind of snapshot load does once the machine's state is in
+// place: rebuild what is derived from it rather than saved.
+static void PostLoadFixups (uint32 old_flags, struct SControlSnapshot *ctl_snap, bool8 update_irq_positions)
 {
-    ByteStream stream;
-    bs_init(&stream, buf, bufSize);
-	S9xFreezeToStream(&stream);
+	CPU.Flags |= old_flags & (DEBUG_MODE_FLAG | TRACE_FLAG | SINGLE_STEP_FLAG | FRAME_ADVANCE_FLAG);
+	ICPU.ShiftedPB = Registers.PB << 16;
+	ICPU.ShiftedDB = Registers.DB << 16;
+	S9xSetPCBase(Registers.PBPC);
+	S9xUnpackStatus();
+	if (update_irq_positions)
+		S9xUpdateIRQPositions(false); // calculate the new trigger pos from saved PPU data
+	S9xFixCycles();
 
-	return (TRUE);
+	// TODO: these should already be correct since they are stored in the snapshot
+	CPU.InDMA = CPU.InHDMA = FALSE;
+	CPU.InDMAorHDMA = CPU.InWRAMDMAorHDMA = FALSE;
+	CPU.HDMARanInDMA = 0;
+
+	S9xFixColourBrightness();
+	S9xBuildDirectColourMaps();
+	IPPU.ColorsChanged = TRUE;
+	IPPU.OBJChanged = TRUE;
+	IPPU.ScreenDirty = TRUE;
+	IPPU.RenderThisFrame = TRUE;
+
+	GFX.DoInterlace = 0;
+
+	S9xGraphicsScreenResize();
+
+	if (Settings.FastSavestates == 0 && GFX.Screen)
+		memset(GFX.Screen,0,GFX.Pitch * MAX_SNES_HEIGHT);
+
+	// TODO: this seems to be a relic from 1.43 changes, completely remove if no issues in the future
+	/*uint8 hdma_byte = Memory.FillRAM[0x420c];
+	S9xSetCPU(hdma_byte, 0x420c);*/
+
+	S9xControlPostLoadState(ctl_snap);
+
+	S9xDirtyAll();
 }
 
-int S9xUnfreezeGameMem (const uint8 *buf, uint32 bufSize)
+// The coprocessors' share of it, for the chips this game has.
+static void ChipPostLoad (uint32 sa1_old_flags)
 {
-    ByteStream stream;
-    bs_init(&stream, (void *) buf, bufSize);
+	if (Settings.SuperFX)
+		GSU.avRegAddr = (uint8 *) &GSU.avReg;
 
-	return S9xUnfreezeFromStream(&stream);
+	if (Settings.SA1)
+	{
+		SA1.Flags |= sa1_old_flags & TRACE_FLAG;
+		S9xSA1PostLoadState();
+	}
+
+	if (Settings.SDD1)
+		S9xSDD1PostLoadState();
+
+	if (Settings.SPC7110)
+		S9xSPC7110PostLoadState();
+
+	if (Settings.SRTC)
+		S9xSRTCPostLoadState();
+
+	if (Settings.BS)
+	{
+		S9xBSXPostLoadState();
+		// The flash chip's transient command state is not serialized;
+		// return it to array-read mode, as a real chip after power-up.
+		S9xBSFlashReset();
+	}
+
+	if (Settings.MSU1)
+		S9xMSU1PostLoadState();
 }
 
-void S9xFreezeToStream (ByteStream *stream)
+// Version 2 snapshots, the kind S9xFreezeGameMem writes: a header, a
+// directory and the sections it lists, each section starting on a 64-byte
+// boundary.
+//
+//   0   SNAPSHOT_V2_MAGIC
+//   8   snapshot version, total size, section count, 0
+//   24  per section: 4-byte name, offset, size
+//
+// Every number is 32-bit little-endian. A memory block is stored as it is. A
+// struct is stored as the fields of its FreezeData table that the version
+// has, in table order, each little-endian and aligned to its own element
+// size, so on a little-endian host every field is a plain copy. Saving
+// writes straight into the caller's buffer and loading reads straight out of
+// it; nothing is allocated. Which sections there are depends only on the
+// game's chips, so the directory is laid out once per game by BuildSections.
+
+#define V2_HEADER_SIZE		24
+#define V2_ENTRY_SIZE		12
+#define V2_MAX_SECTIONS		32
+#define V2_ALIGN(n)			(((n) + 63) & ~(uint32) 63)
+
+// What a layout was worked out for: the chips, and where the memory it
+// points into lives (the coprocessor RAMs sit in the ROM buffer).
+struct SLayoutKey
+{
+	uint32			chips;
+	struct SArena	*arena;		// NULL until laid out
+	uint8			*rom;
+};
+
+struct SSection
 {
-	char	buffer[8192];
-	uint8	*soundsnapshot = new uint8[SPC_SAVE_STATE_BLOCK_SIZE];
+	char			name[4];
+	uint8			*block;			// a memory block, stored as it is,
+	void			*base;			// or a struct, through its table
+	FreezeData		*fields;
+	int				num_fields;
+	const uint32	*stamps;		// the block's dirty-page stamps, if kept
+	uint32			offset;
+	uint32			size;
+};
 
-	sprintf(buffer, "%s:%04d\n", SNAPSHOT_MAGIC, SNAPSHOT_VERSION);
-	bs_write(stream, buffer, strlen(buffer));
+static S9X_TLS struct SSection		Sections[V2_MAX_SECTIONS];
+static S9X_TLS int					NumSections = 0;
+static S9X_TLS uint32				SectionsSize = 0;
+static S9X_TLS struct SLayoutKey	SectionsKey;
 
-	sprintf(buffer, "NAM:%06d:%s%c", 8, "Removed", 0);
-	bs_write(stream, buffer, strlen(buffer) + 1);
+static inline bool8 FieldInVersion (const FreezeData *field, int version)
+{
+	return (version >= field->debuted_in && version < field->deleted_in);
+}
 
-	FreezeStruct(stream, "CPU", &CPU, SnapCPU, COUNT(SnapCPU));
+static int FieldElementSize (const FreezeData *field)
+{
+	switch (field->type)
+	{
+		case uint8_ARRAY_V:
+		case uint8_INDIR_ARRAY_V:
+			return (1);
 
-	FreezeStruct(stream, "REG", &Registers, SnapRegisters, COUNT(SnapRegisters));
+		case uint16_ARRAY_V:
+		case uint16_INDIR_ARRAY_V:
+			return (2);
 
-	FreezeStruct(stream, "PPU", &PPU, SnapPPU, COUNT(SnapPPU));
+		case uint32_ARRAY_V:
+		case uint32_INDIR_ARRAY_V:
+			return (4);
 
-	struct SDMASnapshot	dma_snap;
-	for (int d = 0; d < 8; d++)
-		dma_snap.dma[d] = DMA[d];
-	FreezeStruct(stream, "DMA", &dma_snap, SnapDMA, COUNT(SnapDMA));
+		default:
+			return (field->size);
+	}
+}
 
-	FreezeBlock (stream, "VRA", Memory.VRAM, sizeof(Memory.VRAM));
+static uint8 * FieldAddress (void *base, const FreezeData *field)
+{
+	uint8	*addr = (uint8 *) base + field->offset;
+
+	if (field->type == uint8_INDIR_ARRAY_V || field->type == uint16_INDIR_ARRAY_V || field->type == uint32_INDIR_ARRAY_V)
+		addr = (uint8 *) (*((pint *) addr));
 
-	FreezeBlock (stream, "RAM", Memory.RAM, sizeof(Memory.RAM));
+	return (addr);
+}
 
-	FreezeBlock (stream, "SRA", Memory.SRAM, Memory.SRAM_SIZE);
+// count elements of size bytes, little-endian on the snapshot's side.
+static inline void CopyLE (uint8 *dst, const uint8 *src, int size, int count)
+{
+#ifdef LSB_FIRST
+	memcpy(dst, src, size * count);
+#else
+	for (int i = 0; i < count; i++, dst += size, src += size)
+	{
+		for (int j = 0; j < size; j++)
+			dst[j] = src[size - 1 - j];
+	}
+#endif
+}
 
-	FreezeBlock (stream, "FIL", Memory.FillRAM, 0x8000);
+static uint32 StructSize (const FreezeData *fields, int num_fields, int version)
+{
+	uint32	pos = 0;
 
-	S9xAPUSaveState(soundsnapshot);
-	FreezeBlock (stream, "SND", soundsnapshot, SPC_SAVE_STATE_BLOCK_SIZE);
+	for (int i = 0; i < num_fields; i++)
+	{
+		if (!FieldInVersion(&fields[i], version))
+			continue;
 
-	struct SControlSnapshot	ctl_snap;
-	S9xControlPreSaveState(&ctl_snap);
-	FreezeStruct(stream, "CTL", &ctl_snap, SnapControls, COUNT(SnapControls));
+		uint32	e = FieldElementSize(&fields[i]);
+		pos = (pos + e - 1) & ~(e - 1);
+		pos += FreezeSize(fields[i].size, fields[i].type);
+	}
 
-	Timings.InterlaceField = S9xInterlaceField();
-	FreezeStruct(stream, "TIM", &Timings, SnapTimings, COUNT(SnapTimings));
+	return (pos);
+}
 
-	if (Settings.SuperFX)
+static void EncodeStruct (uint8 *dst, uint32 size, void *base, FreezeData *fields, int num_fields)
+{
+	uint32	pos = 0;
+
+	memset(dst, 0, size);
+
+	for (int i = 0; i < num_fields; i++)
 	{
-		GSU.avRegAddr = (uint8 *) &GSU.avReg;
-		FreezeStruct(stream, "SFX", &GSU, SnapFX, COUNT(SnapFX));
+		const FreezeData	*f = &fields[i];
+
+		if (!FieldInVersion(f, SNAPSHOT_VERSION))
+			continue;
+
+		uint8	*addr = FieldAddress(base, f);
+		int		e = FieldElementSize(f);
+		int		len = FreezeSize(f->size, f->type);
+		int32	relativeAddr;
+
+		// pointers go as offsets from the pointer they lead off
+		if (f->type == POINTER_V)
+		{
+			uint8	*relativeTo = (uint8 *) *((pint *) ((uint8 *) base + f->offset2));
+			relativeAddr = (int32) ((uint8 *) *((pint *) addr) - relativeTo);
+			addr = (uint8 *) &relativeAddr;
+		}
+
+		pos = (pos + e - 1) & ~(e - 1);
+		CopyLE(dst + pos, addr, e, len / e);
+		pos += len;
+	}
+}
+
+static void DecodeStruct (const uint8 *src, void *sbase, FreezeData *fields, int num_fields, int version)
+{
+	uint32	pos = 0;
+
+	for (int i = 0; i < num_fields; i++)
+	{
+		const FreezeData	*f = &fields[i];
+
+		if (!FieldInVersion(f, version))
+			continue;
+
+		int	e = FieldElementSize(f);
+		int	len = FreezeSize(f->size, f->type);
+
+		pos = (pos + e - 1) & ~(e - 1);
+
+		// as in the stream format, fields obsolete since the snapshot was
+		// taken land in Obsolete and deleted ones are passed over
+		void	*base = (SNAPSHOT_VERSION >= f->deleted_in) ? ((void *) &Obsolete) : sbase;
+
+		if (f->offset >= 0)
+		{
+			uint8	*addr = FieldAddress(base, f);
+
+			if (f->type == POINTER_V)
+			{
+				int32	relativeAddr;
+				uint8	*relativeTo = (uint8 *) *((pint *) ((uint8 *) base + f->offset2));
+				CopyLE((uint8 *) &relativeAddr, src + pos, 4, 1);
+				*((pint *) addr) = (pint) (relativeTo + relativeAddr);
+			}
+			else
+				CopyLE(addr, src + pos, e, len / e);
+		}
+
+		pos += len;
+	}
+}
+
+static uint32 ChipKey (void)
+{
+	return ((Settings.SuperFX          ? 1 <<  0 : 0) |
+			(Settings.SA1              ? 1 <<  1 : 0) |
+			((Settings.DSP & 7)             <<  2)     |
+			(Settings.C4               ? 1 <<  5 : 0) |
+			(Settings.SETA == ST_010   ? 1 <<  6 : 0) |
+			(Settings.OBC1             ? 1 <<  7 : 0) |
+			(Settings.SPC7110          ? 1 <<  8 : 0) |
+			(Settings.SRTC             ? 1 <<  9 : 0) |
+			(Settings.SPC7110RTC       ? 1 << 10 : 0) |
+			(Settings.BS               ? 1 << 11 : 0) |
+			(Settings.MSU1             ? 1 << 12 : 0));
+}
+
+// A layout worked out for one game holds until a game with other chips is
+// loaded or the memory is allocated afresh. Asking is cheap enough for every
+// retro_serialize_size.
+static bool8 LayoutStale (struct SLayoutKey *key)
+{
+	uint32	chips = ChipKey();
+
+	if (key->arena == Memory.Arena && key->rom == Memory.ROM && key->chips == chips)
+		return (FALSE);
+
+	key->chips = chips;
+	key->arena = Memory.Arena;
+	key->rom   = Memory.ROM;
+
+	return (TRUE);
+}
+
+static void BuildSections (void)
+{
+	int	n = 0;
+
+	if (!LayoutStale(&SectionsKey))
+		return;
+
+#define SECTION(id, p, b, t, c, len, st) \
+	{ \
+		struct SSection	*s = &Sections[n++]; \
+		memcpy(s->name, id, 4); \
+		s->block = (uint8 *) (p); \
+		s->base = (b); \
+		s->fields = (t); \
+		s->num_fields = (c); \
+		s->size = (len); \
+		s->stamps = (st); \
 	}
+#define SECTION_STRUCT(id, b, t)		SECTION(id, NULL, b, t, COUNT(t), StructSize(t, COUNT(t), SNAPSHOT_VERSION), NULL)
+#define SECTION_BLOCK(id, p, len, st)	SECTION(id, p, NULL, NULL, 0, len, st)
+
+	SECTION_STRUCT("CPU", &CPU, SnapCPU);
+	SECTION_STRUCT("REG", &Registers, SnapRegisters);
+	SECTION_STRUCT("PPU", &PPU, SnapPPU);
+	SECTION_STRUCT("DMA", &DMASnap, SnapDMA);
+	SECTION_BLOCK ("VRA", Memory.VRAM, sizeof(SArena::VRAM), Dirty.VRAM);
+	SECTION_BLOCK ("RAM", Memory.RAM, sizeof(SArena::RAM), Dirty.RAM);
+	SECTION_BLOCK ("SRA", Memory.SRAM, sizeof(SArena::SRAM), Dirty.SRAM);
+	SECTION_BLOCK ("FIL", Memory.FillRAM, 0x8000, Dirty.FillRAM);
+	SECTION_BLOCK ("ARA", Memory.Arena->APURAM, sizeof(SArena::APURAM), Dirty.ARAM);
+	SECTION_BLOCK ("SND", APURegisters, sizeof(APURegisters), NULL);
+	SECTION_STRUCT("CTL", &CtlSnap, SnapControls);
+	SECTION_STRUCT("TIM", &Timings, SnapTimings);
+
+	if (Settings.SuperFX)
+		SECTION_STRUCT("SFX", &GSU, SnapFX);
 
 	if (Settings.SA1)
 	{
-		S9xSA1PackStatus();
-		FreezeStruct(stream, "SA1", &SA1, SnapSA1, COUNT(SnapSA1));
-		FreezeStruct(stream, "SAR", &SA1Registers, SnapSA1Registers, COUNT(SnapSA1Registers));
+		SECTION_STRUCT("SA1", &SA1, SnapSA1);
+		SECTION_STRUCT("SAR", &SA1Registers, SnapSA1Registers);
 	}
 
 	if (Settings.DSP == 1)
-		FreezeStruct(stream, "DP1", &DSP1, SnapDSP1, COUNT(SnapDSP1));
+		SECTION_STRUCT("DP1", &DSP1, SnapDSP1);
 
 	if (Settings.DSP == 2)
-		FreezeStruct(stream, "DP2", &DSP2, SnapDSP2, COUNT(SnapDSP2));
+		SECTION_STRUCT("DP2", &DSP2, SnapDSP2);
 
 	if (Settings.DSP == 4)
-		FreezeStruct(stream, "DP4", &DSP4, SnapDSP4, COUNT(SnapDSP4));
+		SECTION_STRUCT("DP4", &DSP4, SnapDSP4);
 
 	if (Settings.C4)
-		FreezeBlock (stream, "CX4", Memory.C4RAM, 8192);
+		SECTION_BLOCK ("CX4", Memory.C4RAM, 8192, NULL);
 
 	if (Settings.SETA == ST_010)
-		FreezeStruct(stream, "ST0", &ST010, SnapST010, COUNT(SnapST010));
+		SECTION_STRUCT("ST0", &ST010, SnapST010);
 
 	if (Settings.OBC1)
 	{
-		FreezeStruct(stream, "OBC", &OBC1, SnapOBC1, COUNT(SnapOBC1));
-		FreezeBlock (stream, "OBM", Memory.OBC1RAM, 8192);
+		SECTION_STRUCT("OBC", &OBC1, SnapOBC1);
+		SECTION_BLOCK ("OBM", Memory.OBC1RAM, 8192, NULL);
 	}
 
 	if (Settings.SPC7110)
+		SECTION_STRUCT("S71", &s7snap, SnapSPC7110Snap);
+
+	if (Settings.SRTC)
+		SECTION_STRUCT("SRT", &srtcsnap, SnapSRTCSnap);
+
+	if (Settings.SRTC || Settings.SPC7110RTC)
+		SECTION_BLOCK ("CLK", RTCData.reg, 20, NULL);
+
+	if (Settings.BS)
+		SECTION_STRUCT("BSX", &BSX, SnapBSX);
+
+	if (Settings.MSU1)
+		SECTION_STRUCT("MSU", &MSU1, SnapMSU1);
+
+#undef SECTION_BLOCK
+#undef SECTION_STRUCT
+#undef SECTION
+
+	assert(n <= V2_MAX_SECTIONS);
+
+	uint32	offset = V2_ALIGN(V2_HEADER_SIZE + n * V2_ENTRY_SIZE);
+	for (int i = 0; i < n; i++)
 	{
-		S9xSPC7110PreSaveState();
-		FreezeStruct(stream, "S71", &s7snap, SnapSPC7110Snap, COUNT(SnapSPC7110Snap));
+		Sections[i].offset = offset;
+		offset = V2_ALIGN(offset + Sections[i].size);
 	}
 
-	if (Settings.SRTC)
+	NumSections  = n;
+	SectionsSize = offset;
+}
+
+static void WriteSection (const struct SSection *s, uint8 *dst)
+{
+	if (s->fields)
+		EncodeStruct(dst, s->size, s->base, s->fields, s->num_fields);
+	else
+		memcpy(dst, s->block, s->size);
+}
+
+static int UnfreezeV2 (const uint8 *buf, uint32 bufSize)
+{
+	const uint8	*src[V2_MAX_SECTIONS];
+
+	if (bufSize < V2_HEADER_SIZE)
+		return (WRONG_FORMAT);
+
+	uint32	version = READ_DWORD(buf + 8);
+	uint32	size    = READ_DWORD(buf + 12);
+	uint32	count   = READ_DWORD(buf + 16);
+
+	if (version > SNAPSHOT_VERSION)
+		return (WRONG_VERSION);
+
+	if (size > bufSize || size < V2_HEADER_SIZE || count > (size - V2_HEADER_SIZE) / V2_ENTRY_SIZE)
+		return (WRONG_FORMAT);
+
+	BuildSections();
+
+	// Find every section this game needs before touching anything, so that a
+	// state which does not fit leaves the machine as it was.
+	for (int i = 0; i < NumSections; i++)
 	{
-		S9xSRTCPreSaveState();
-		FreezeStruct(stream, "SRT", &srtcsnap, SnapSRTCSnap, COUNT(SnapSRTCSnap));
+		const struct SSection	*s = &Sections[i];
+		uint32					want = s->fields ? StructSize(s->fields, s->num_fields, version) : s->size;
+
+		src[i] = NULL;
+
+		for (uint32 j = 0; j < count; j++)
+		{
+			const uint8	*entry  = buf + V2_HEADER_SIZE + j * V2_ENTRY_SIZE;
+			uint32		offset = READ_DWORD(entry + 4);
+			uint32		len    = READ_DWORD(entry + 8);
+
+			if (!memcmp(entry, s->name, 4) && len == want && offset <= size && len <= size - offset)
+			{
+				src[i] = buf + offset;
+				break;
+			}
+		}
+
+		if (!src[i])
+			return (WRONG_FORMAT);
+	}
+
+	uint32	old_flags     = CPU.Flags;
+	uint32	sa1_old_flags = SA1.Flags;
+
+	if (Settings.FastSavestates)
+		S9xResetPPUFast();
+	else
+		S9xReset();
+
+	if (Settings.SuperFX)
+		GSU.avRegAddr = (uint8 *) &GSU.avReg;
+
+	for (int i = 0; i < NumSections; i++)
+	{
+		const struct SSection	*s = &Sections[i];
+
+		if (s->fields)
+			DecodeStruct(src[i], s->base, s->fields, s->num_fields, version);
+		else
+		{
+			if (s->block == Memory.VRAM)
+				S9xInvalidateVRAMChanges(src[i]);
+
+			memcpy(s->block, src[i], s->size);
+		}
+	}
+
+	for (int d = 0; d < 8; d++)
+		DMA[d] = DMASnap.dma[d];
+
+	S9xAPULoadRegisters(APURegisters);
+
+	PostLoadFixups(old_flags, &CtlSnap, FALSE);
+	ChipPostLoad(sa1_old_flags);
+
+	return (SUCCESS);
+}
+
+uint32 S9xFreezeSize (void)
+{
+	BuildSections();
+
+	return (SectionsSize);
+}
+
+bool8 S9xFreezeGameMem (uint8 *buf, uint32 bufSize)
+{
+	BuildSections();
+
+	if (bufSize < SectionsSize)
+		return (FALSE);
+
+	PreSaveState();
+
+	memset(buf, 0, Sections[0].offset);
+	memcpy(buf, SNAPSHOT_V2_MAGIC, 8);
+	WRITE_DWORD(buf +  8, SNAPSHOT_VERSION);
+	WRITE_DWORD(buf + 12, SectionsSize);
+	WRITE_DWORD(buf + 16, NumSections);
+
+	for (int i = 0; i < NumSections; i++)
+	{
+		const struct SSection	*s = &Sections[i];
+		uint8					*entry = buf + V2_HEADER_SIZE + i * V2_ENTRY_SIZE;
+		uint32					end = (i + 1 < NumSections) ? Sections[i + 1].offset : SectionsSize;
+
+		memcpy(entry, s->name, 4);
+		WRITE_DWORD(entry + 4, s->offset);
+		WRITE_DWORD(entry + 8, s->size);
+
+		WriteSection(s, buf + s->offset);
+		memset(buf + s->offset + s->size, 0, end - s->offset - s->size);
 	}
 
+	// A buffer sized for a raw snapshot can be the larger; leave no garbage.
+	memset(buf + SectionsSize, 0, bufSize - SectionsSize);
+
+	return (TRUE);
+}
+
+int S9xUnfreezeGameMem (const uint8 *buf, uint32 bufSize)
+{
+	if (bufSize >= 8 && !memcmp(buf, SNAPSHOT_V2_MAGIC, 8))
+		return (UnfreezeV2(buf, bufSize));
+
+	// version 1, the block stream
+	ByteStream	stream;
+	bs_init(&stream, (void *) buf, bufSize);
+
+	return (S9xUnfreezeFromStream(&stream));
+}
+
+// Delta snapshots: records over a version 2 snapshot, holding the struct
+// sections whole and, of the memory blocks, the pages stamped after the
+// baseline. See dirty.h.
+
+// Shadows for the blocks stamped by comparison. Left in BSS so that they
+// cost nothing until deltas are used.
+static S9X_TLS uint8	ShadowSRAM[0x80000];
+static S9X_TLS uint8	ShadowFillRAM[0x8000];
+static S9X_TLS uint8	ShadowRAM[0x20000];
+static S9X_TLS uint8	ShadowVRAM[0x10000];
+static S9X_TLS bool8	ScanRAM = FALSE, ScanVRAM = FALSE;
+
+static void ScanPages (const uint8 *live, uint8 *shadow, uint32 *stamps, uint32 size)
+{
+	for (uint32 o = 0; o < size; o += DIRTY_PAGE_SIZE)
+	{
+		if (memcmp(live + o, shadow + o, DIRTY_PAGE_SIZE))
+		{
+			memcpy(shadow + o, live + o, DIRTY_PAGE_SIZE);
+			stamps[o >> DIRTY_PAGE_SHIFT] = Dirty.Serial;
+		}
+	}
+}
+
+static void ScanUnhookedPages (void)
+{
+	ScanPages(Memory.SRAM, ShadowSRAM, Dirty.SRAM, Memory.SRAM_SIZE);
+	ScanPages(Memory.FillRAM, ShadowFillRAM, Dirty.FillRAM, 0x8000);
+
+	if (ScanRAM)
+		ScanPages(Memory.RAM, ShadowRAM, Dirty.RAM, 0x20000);
+	if (ScanVRAM)
+		ScanPages(Memory.VRAM, ShadowVRAM, Dirty.VRAM, 0x10000);
+}
+
+// Until now every write went through the hooks, so the block as it stands
+// is what its stamps describe.
+void S9xDirtyUnhooked (const uint8 *memory)
+{
+	if (memory == Memory.RAM && !ScanRAM)
+	{
+		memcpy(ShadowRAM, Memory.RAM, 0x20000);
+		ScanRAM = TRUE;
+	}
+	else
+	if (memory == Memory.VRAM && !ScanVRAM)
+	{
+		memcpy(ShadowVRAM, Memory.VRAM, 0x10000);
+		ScanVRAM = TRUE;
+	}
+}
+
+static void StampAll (uint32 *stamps, int count)
+{
+	for (int i = 0; i < count; i++)
+		stamps[i] = Dirty.Serial;
+}
+
+void S9xDirtyAll (void)
+{
+	StampAll(Dirty.RAM, COUNT(Dirty.RAM));
+	StampAll(Dirty.VRAM, COUNT(Dirty.VRAM));
+	StampAll(Dirty.ARAM, COUNT(Dirty.ARAM));
+	StampAll(Dirty.SRAM, COUNT(Dirty.SRAM));
+	StampAll(Dirty.FillRAM, COUNT(Dirty.FillRAM));
+}
+
+uint32 S9xDeltaBaseline (void)
+{
+	ScanUnhookedPages();
+
+	return (Dirty.Serial++);
+}
+
+struct SDeltaWriter
+{
+	uint8	*buf;
+	uint32	size;
+	uint32	pos;
+	uint32	open;		// length field of the last record
+	uint32	end;		// snapshot offset the last record reaches
+	bool8	full;
+};
+
+// Room for len bytes at offset in the snapshot: on the end of the last
+// record if it reaches just that far, or in a new one. NULL once the delta
+// no longer fits.
+static uint8 * DeltaRecord (struct SDeltaWriter *w, uint32 offset, uint32 len)
+{
+	if (w->full)
+		return (NULL);
+
+	if (offset != w->end)
+	{
+		if (w->size - w->pos < 8)
+		{
+			w->full = TRUE;
+			return (NULL);
+		}
+
+		WRITE_DWORD(w->buf + w->pos, offset);
+		WRITE_DWORD(w->buf + w->pos + 4, 0);
+		w->open = w->pos + 4;
+		w->pos += 8;
+	}
+
+	if (w->size - w->pos < len)
+	{
+		w->full = TRUE;
+		return (NULL);
+	}
+
+	uint8	*p = w->buf + w->pos;
+
+	WRITE_DWORD(w->buf + w->open, READ_DWORD(w->buf + w->open) + len);
+	w->pos += len;
+	w->end  = offset + len;
+
+	return (p);
+}
+
+uint32 S9xFreezeDelta (uint8 *buf, uint32 bufSize, uint32 baseline, uint32 *next)
+{
+	struct SDeltaWriter	w = { buf, bufSize, DELTA_HEADER_SIZE, 0, (uint32) -1, FALSE };
+
+	if (bufSize < DELTA_HEADER_SIZE)
+		return (0);
+
+	ScanUnhookedPages();
+	if (next)
+		*next = Dirty.Serial++;
+
+	BuildSections();
+	PreSaveState();
+
+	memcpy(buf, DELTA_MAGIC, 8);
+	WRITE_DWORD(buf + 8, SectionsSize);
+
+	for (int i = 0; i < NumSections; i++)
+	{
+		const struct SSection	*s = &Sections[i];
+		uint8					*p;
+
+		if (s->stamps)
+		{
+			for (uint32 o = 0; o < s->size; o += DIRTY_PAGE_SIZE)
+			{
+				if (s->stamps[o >> DIRTY_PAGE_SHIFT] > baseline && (p = DeltaRecord(&w, s->offset + o, DIRTY_PAGE_SIZE)))
+					memcpy(p, s->block + o, DIRTY_PAGE_SIZE);
+			}
+		}
+		else
+		if ((p = DeltaRecord(&w, s->offset, s->size)))
+			WriteSection(s, p);
+	}
+
+	return (w.full ? 0 : w.pos);
+}
+
+// State hashes: a fingerprint of everything a version 2 snapshot would
+// hold, kept up to date the way deltas are. Every page of the paged blocks
+// keeps a hash of its own, seeded with where the page sits in the snapshot,
+// and the fingerprint takes their sum, so only the pages stamped since the
+// last hash are read again. The rest of the snapshot is a few KB and is
+// hashed whole each time.
+
+#define HASH_PAGES	((0x20000 + 0x10000 + 0x10000 + 0x80000 + 0x8000) >> DIRTY_PAGE_SHIFT)
+
+static S9X_TLS uint64			PageHash[HASH_PAGES];
+static S9X_TLS uint64			PageSum;
+static S9X_TLS uint32			HashBaseline;
+static S9X_TLS struct SArena	*HashArena = NULL;	// NULL until every page is hashed
+static S9X_TLS uint8			*HashScratch = NULL;
+static S9X_TLS uint32			HashScratchSize = 0;
+
+uint64 S9xStateHash (void)
+{
+	bool8	all = (HashArena != Memory.Arena);
+	uint32	page = 0;
+	uint64	h = 0;
+
+	ScanUnhookedPages();
+	BuildSections();
+	PreSaveState();
+
+	for (int i = 0; i < NumSections; i++)
+	{
+		const struct SSection	*s = &Sections[i];
+
+		if (s->stamps)
+		{
+			for (uint32 o = 0; o < s->size && page < HASH_PAGES; o += DIRTY_PAGE_SIZE, page++)
+			{
+				if (all || s->stamps[o >> DIRTY_PAGE_SHIFT] > HashBaseline)
+				{
+					uint64	ph = S9xHash64(s->block + o, DIRTY_PAGE_SIZE, s->offset + o);
+					PageSum += ph - PageHash[page];
+					PageHash[page] = ph;
+				}
+			}
+		}
+		else
+		if (s->fields)
+		{
+			if (s->size > HashScratchSize)
+			{
+				free(HashScratch);
+				HashScratch = (uint8 *) malloc(s->size);
+				HashScratchSize = HashScratch ? s->size : 0;
+				if (!HashScratch)
+					continue;
+			}
+
+			EncodeStruct(HashScratch, s->size, s->base, s->fields, s->num_fields);
+			h = S9xHash64(HashScratch, s->size, h);
+		}
+		else
+			h = S9xHash64(s->block, s->size, h);
+	}
+
+	assert(page == HASH_PAGES);
+
+	HashBaseline = Dirty.Serial++;
+	HashArena = Memory.Arena;
+
+	uint8	sum[8];
+	WRITE_DWORD(sum, (uint32) PageSum);
+	WRITE_DWORD(sum + 4, (uint32) (PageSum >> 32));
+
+	return (S9xHash64(sum, 8, h));
+}
+
+bool8 S9xApplyDelta (uint8 *state, uint32 stateSize, const uint8 *delta, uint32 deltaSize)
+{
+	if (deltaSize < DELTA_HEADER_SIZE || memcmp(delta, DELTA_MAGIC, 8) || READ_DWORD(delta + 8) != stateSize)
+		return (FALSE);
+
+	for (uint32 pos = DELTA_HEADER_SIZE; pos < deltaSize; )
+	{
+		if (deltaSize - pos < 8)
+			return (FALSE);
+
+		uint32	offset = READ_DWORD(delta + pos);
+		uint32	len    = READ_DWORD(delta + pos + 4);
+		pos += 8;
+
+		if (len > deltaSize - pos || offset > stateSize || len > stateSize - offset)
+			return (FALSE);
+
+		memcpy(state + offset, delta + pos, len);
+		pos += len;
+	}
+
+	return (TRUE);
+}
+
+// Raw snapshots: the machine's state copied as it lies in memory, for
+// keeping and restoring within this process while this game stays loaded
+// (runahead's rollback and the frontend's same-instance states). The struct
+// copies carry pointers - CPU.PCBase, GSU's and SA-1's into the ROM, others
+// into the arena - so the header names the loaded game and where its ROM and
+// the arena lay, and anything else is refused.
+
+#define RAW_MAGIC			"#!s9xraw"
+#define RAW_HEADER_SIZE		32		// magic, size, ROM CRC32, arena address, ROM address
+#define RAW_MAX_BLOCKS		24
+
+struct SRawBlock
+{
+	void	*data;
+	uint32	size;
+};
+
+static S9X_TLS struct SRawBlock		RawList[RAW_MAX_BLOCKS];
+static S9X_TLS int					NumRawBlocks = 0;
+static S9X_TLS uint32				RawSize = 0;	// the whole snapshot
+static S9X_TLS struct SLayoutKey	RawKey;
+
+static void BuildRawBlocks (void)
+{
+	int	n = 0;
+
+	if (!LayoutStale(&RawKey))
+		return;
+
+#define RAW_BLOCK(p, s)	{ RawList[n].data = (void *) (p); RawList[n].size = (uint32) (s); n++; }
+
+	RAW_BLOCK(Memory.Arena, sizeof(struct SArena));
+	RAW_BLOCK(Memory.FillRAM, 0x8000);
+	RAW_BLOCK(APURegisters, sizeof(APURegisters));
+	RAW_BLOCK(&CtlSnap, sizeof(CtlSnap));
+	RAW_BLOCK(&CPU, sizeof(CPU));
+	RAW_BLOCK(&Registers, sizeof(Registers));
+	RAW_BLOCK(&PPU, sizeof(PPU));
+	RAW_BLOCK(DMA, sizeof(DMA));
+	RAW_BLOCK(&Timings, sizeof(Timings));
+
+	if (Settings.SuperFX)
+		RAW_BLOCK(&GSU, sizeof(GSU));
+
+	if (Settings.SA1)
+	{
+		RAW_BLOCK(&SA1, sizeof(SA1));
+		RAW_BLOCK(&SA1Registers, sizeof(SA1Registers));
+	}
+
+	if (Settings.DSP == 1)
+		RAW_BLOCK(&DSP1, sizeof(DSP1));
+
+	if (Settings.DSP == 2)
+		RAW_BLOCK(&DSP2, sizeof(DSP2));
+
+	if (Settings.DSP == 4)
+		RAW_BLOCK(&DSP4, sizeof(DSP4));
+
+	if (Settings.C4)
+		RAW_BLOCK(Memory.C4RAM, 8192);
+
+	if (Settings.SETA == ST_010)
+		RAW_BLOCK(&ST010, sizeof(ST010));
+
+	if (Settings.OBC1)
+	{
+		RAW_BLOCK(&OBC1, sizeof(OBC1));
+		RAW_BLOCK(Memory.OBC1RAM, 8192);
+	}
+
+	if (Settings.SPC7110)
+		RAW_BLOCK(&s7snap, sizeof(s7snap));
+
+	if (Settings.SRTC)
+		RAW_BLOCK(&srtcsnap, sizeof(srtcsnap));
+
 	if (Settings.SRTC || Settings.SPC7110RTC)
-		FreezeBlock (stream, "CLK", RTCData.reg, 20);
+		RAW_BLOCK(RTCData.reg, 20);
 
 	if (Settings.BS)
-		FreezeStruct(stream, "BSX", &BSX, SnapBSX, COUNT(SnapBSX));
+		RAW_BLOCK(&BSX, sizeof(BSX));
 
 	if (Settings.MSU1)
+		RAW_BLOCK(&MSU1, sizeof(MSU1));
+
+#undef RAW_BLOCK
+
+	assert(n <= RAW_MAX_BLOCKS);
+
+	NumRawBlocks = n;
+	RawSize = RAW_HEADER_SIZE;
+	for (int i = 0; i < n; i++)
+		RawSize += RawList[i].size;
+}
+
+uint32 S9xFreezeRawSize (void)
+{
+	BuildRawBlocks();
+
+	return (RawSize);
+}
+
+bool8 S9xFreezeRaw (uint8 *buf, uint32 bufSize)
+{
+	BuildRawBlocks();
+
+	if (bufSize < RawSize)
+		return (FALSE);
+
+	PreSaveState();
+
+	uint64	arena = (uint64) (uintptr_t) Memory.Arena;
+	uint64	rom   = (uint64) (uintptr_t) Memory.ROM;
+
+	memcpy(buf, RAW_MAGIC, 8);
+	WRITE_DWORD(buf + 8, RawSize);
+	WRITE_DWORD(buf + 12, Memory.ROMCRC32);
+	WRITE_DWORD(buf + 16, (uint32) arena);
+	WRITE_DWORD(buf + 20, (uint32) (arena >> 32));
+	WRITE_DWORD(buf + 24, (uint32) rom);
+	WRITE_DWORD(buf + 28, (uint32) (rom >> 32));
+
+	uint8	*p = buf + RAW_HEADER_SIZE;
+	for (int i = 0; i < NumRawBlocks; i++)
 	{
-		S9xMSU1PreSaveState();
-		FreezeStruct(stream, "MSU", &MSU1, SnapMSU1, COUNT(SnapMSU1));
+		memcpy(p, RawList[i].data, RawList[i].size);
+		p += RawList[i].size;
 	}
 
-	delete [] soundsnapshot;
+	return (TRUE);
+}
+
+int S9xUnfreezeRaw (const uint8 *buf, uint32 bufSize)
+{
+	uint64	arena = (uint64) (uintptr_t) Memory.Arena;
+	uint64	rom   = (uint64) (uintptr_t) Memory.ROM;
+
+	BuildRawBlocks();
+
+	if (bufSize < RAW_HEADER_SIZE || memcmp(buf, RAW_MAGIC, 8))
+		return (WRONG_FORMAT);
+
+	if (READ_DWORD(buf + 8) != RawSize || bufSize < RawSize ||
+		READ_DWORD(buf + 12) != Memory.ROMCRC32 ||
+		READ_DWORD(buf + 16) != (uint32) arena || READ_DWORD(buf + 20) != (uint32) (arena >> 32) ||
+		READ_DWORD(buf + 24) != (uint32) rom || READ_DWORD(buf + 28) != (uint32) (rom >> 32))
+		return (WRONG_VERSION);
+
+	uint32	old_flags     = CPU.Flags;
+	uint32	sa1_old_flags = SA1.Flags;
+
+	// The satellaview streams belong to the open files, not the snapshot.
+	RFILE	*sat_stream1 = BSX.sat_stream1;
+	RFILE	*sat_stream2 = BSX.sat_stream2;
+
+	// The arena leads, VRAM within it.
+	S9xInvalidateVRAMChanges(buf + RAW_HEADER_SIZE + offsetof(struct SArena, VRAM));
+
+	const uint8	*p = buf + RAW_HEADER_SIZE;
+	for (int i = 0; i < NumRawBlocks; i++)
+	{
+		memcpy(RawList[i].data, p, RawList[i].size);
+		p += RawList[i].size;
+	}
+
+	BSX.sat_stream1 = sat_stream1;
+	BSX.sat_stream2 = sat_stream2;
+
+	S9xResetPPUFast();
+	S9xAPULoadRegisters(APURegisters);
+
+	PostLoadFixups(old_flags, &CtlSnap, FALSE);
+	ChipPostLoad(sa1_old_flags);
+
+	return (SUCCESS);
 }
 
 int S9xUnfreezeFromStream (ByteStream *stream)
@@ -1209,9 +2081,9 @@ int S9xUnfreezeFromStream (ByteStream *stream)
 			break;
 
 		if (fast)
-			result = UnfreezeBlock(stream, "RAM", Memory.RAM, sizeof(Memory.RAM));
+			result = UnfreezeBlock(stream, "RAM", Memory.RAM, sizeof(SArena::RAM));
 		else
-			result = UnfreezeBlockCopy(stream, "RAM", &local_ram, sizeof(Memory.RAM));
+			result = UnfreezeBlockCopy(stream, "RAM", &local_ram, sizeof(SArena::RAM));
 		if (result != SUCCESS)
 			break;
 
@@ -1332,6 +2204,7 @@ int S9xUnfreezeFromStream (ByteStream *stream)
 		if (fast)
 		{
 			S9xResetPPUFast();
+			S9xInvalidateTileCache();
 		}
 		else
 		{
@@ -1478,40 +2351,10 @@ int S9xUnfreezeFromStream (ByteStream *stream)
 			}
 		}
 
-		CPU.Flags |= old_flags & (DEBUG_MODE_FLAG | TRACE_FLAG | SINGLE_STEP_FLAG | FRAME_ADVANCE_FLAG);
-		ICPU.ShiftedPB = Registers.PB << 16;
-		ICPU.ShiftedDB = Registers.DB << 16;
-		S9xSetPCBase(Registers.PBPC);
-		S9xUnpackStatus();
-		if(version < SNAPSHOT_VERSION_IRQ_2018)
-			S9xUpdateIRQPositions(false); // calculate the new trigger pos from saved PPU data
-		S9xFixCycles();
-
 		for (int d = 0; d < 8; d++)
 			DMA[d] = dma_snap.dma[d];
-		// TODO: these should already be correct since they are stored in the snapshot
-		CPU.InDMA = CPU.InHDMA = FALSE;
-		CPU.InDMAorHDMA = CPU.InWRAMDMAorHDMA = FALSE;
-		CPU.HDMARanInDMA = 0;
-
-		S9xFixColourBrightness();
-		S9xBuildDirectColourMaps();
-		IPPU.ColorsChanged = TRUE;
-		IPPU.OBJChanged = TRUE;
-		IPPU.RenderThisFrame = TRUE;
-
-		GFX.DoInterlace = 0;
-
-		S9xGraphicsScreenResize();
 
-		if (Settings.FastSavestates == 0)
-			memset(GFX.Screen,0,GFX.Pitch * MAX_SNES_HEIGHT);
-
-		// TODO: this seems to be a relic from 1.43 changes, completely remove if no issues in the future
-		/*uint8 hdma_byte = Memory.FillRAM[0x420c];
-		S9xSetCPU(hdma_byte, 0x420c);*/
-
-		S9xControlPostLoadState(&ctl_snap);
+		PostLoadFixups(old_flags, &ctl_snap, version < SNAPSHOT_VERSION_IRQ_2018);
 
 		if (local_superfx)
 		{
@@ -1594,151 +2437,6 @@ static int FreezeSize (int size, int type)
 	}
 }
 
-static void FreezeStruct (ByteStream *stream, const char *name, void *base, FreezeData *fields, int num_fields)
-{
-	int	len = 0;
-	int	i, j;
-
-	for (i = 0; i < num_fields; i++)
-	{
-		if (SNAPSHOT_VERSION < fields[i].debuted_in)
-		{
-			fprintf(stderr, "%s[%p]: field has bad debuted_in value %d, > %d.", name, (void *) fields, fields[i].debuted_in, SNAPSHOT_VERSION);
-			continue;
-		}
-
-		if (SNAPSHOT_VERSION < fields[i].deleted_in)
-			len += FreezeSize(fields[i].size, fields[i].type);
-	}
-
-	uint8	*block = new uint8[len];
-	uint8	*ptr = block;
-	uint8	*addr;
-	uint16	word;
-	uint32	dword;
-	int64	qaword;
-	int		relativeAddr;
-
-	for (i = 0; i < num_fields; i++)
-	{
-		if (SNAPSHOT_VERSION >= fields[i].deleted_in || SNAPSHOT_VERSION < fields[i].debuted_in)
-			continue;
-
-		addr = (uint8 *) base + fields[i].offset;
-
-		// determine real address of indirect-type fields
-		// (where the structure contains a pointer to an array rather than the array itself)
-		if (fields[i].type == uint8_INDIR_ARRAY_V || fields[i].type == uint16_INDIR_ARRAY_V || fields[i].type == uint32_INDIR_ARRAY_V)
-			addr = (uint8 *) (*((pint *) addr));
-
-		// convert pointer-type saves from absolute to relative pointers
-		if (fields[i].type == POINTER_V)
-		{
-			uint8	*pointer    = (uint8 *) *((pint *) ((uint8 *) base + fields[i].offset));
-			uint8	*relativeTo = (uint8 *) *((pint *) ((uint8 *) base + fields[i].offset2));
-			relativeAddr = pointer - relativeTo;
-			addr = (uint8 *) &relativeAddr;
-		}
-
-		switch (fields[i].type)
-		{
-			case INT_V:
-			case POINTER_V:
-				switch (fields[i].size)
-				{
-					case 1:
-						*ptr++ = *(addr);
-						break;
-
-					case 2:
-						word = *((uint16 *) (addr));
-						*ptr++ = (uint8) (word >> 8);
-						*ptr++ = (uint8) word;
-						break;
-
-					case 4:
-						dword = *((uint32 *) (addr));
-						*ptr++ = (uint8) (dword >> 24);
-						*ptr++ = (uint8) (dword >> 16);
-						*ptr++ = (uint8) (dword >> 8);
-						*ptr++ = (uint8) dword;
-						break;
-
-					case 8:
-						qaword = *((int64 *) (addr));
-						*ptr++ = (uint8) (qaword >> 56);
-						*ptr++ = (uint8) (qaword >> 48);
-						*ptr++ = (uint8) (qaword >> 40);
-						*ptr++ = (uint8) (qaword >> 32);
-						*ptr++ = (uint8) (qaword >> 24);
-						*ptr++ = (uint8) (qaword >> 16);
-						*ptr++ = (uint8) (qaword >> 8);
-						*ptr++ = (uint8) qaword;
-						break;
-				}
-
-				break;
-
-			case uint8_ARRAY_V:
-			case uint8_INDIR_ARRAY_V:
-				memmove(ptr, addr, fields[i].size);
-				ptr += fields[i].size;
-
-				break;
-
-			case uint16_ARRAY_V:
-			case uint16_INDIR_ARRAY_V:
-				for (j = 0; j < fields[i].size; j++)
-				{
-					word = *((uint16 *) (addr + j * 2));
-					*ptr++ = (uint8) (word >> 8);
-					*ptr++ = (uint8) word;
-				}
-
-				break;
-
-			case uint32_ARRAY_V:
-			case uint32_INDIR_ARRAY_V:
-				for (j = 0; j < fields[i].size; j++)
-				{
-					dword = *((uint32 *) (addr + j * 4));
-					*ptr++ = (uint8) (dword >> 24);
-					*ptr++ = (uint8) (dword >> 16);
-					*ptr++ = (uint8) (dword >> 8);
-					*ptr++ = (uint8) dword;
-				}
-
-				break;
-		}
-	}
-
-	FreezeBlock(stream, name, block, len);
-	delete [] block;
-}
-
-static void FreezeBlock (ByteStream *stream, const char *name, uint8 *block, int size)
-{
-	char	buffer[20];
-
-	// check if it fits in 6 digits. (letting it go over and using strlen isn't safe)
-	if (size <= 999999)
-		sprintf(buffer, "%s:%06d:", name, size);
-	else
-	{
-		// to make it fit, pack it in the bytes instead of as digits
-		sprintf(buffer, "%s:------:", name);
-		buffer[6] = (unsigned char) ((unsigned) size >> 24);
-		buffer[7] = (unsigned char) ((unsigned) size >> 16);
-		buffer[8] = (unsigned char) ((unsigned) size >> 8);
-		buffer[9] = (unsigned char) ((unsigned) size >> 0);
-	}
-
-	buffer[11] = 0;
-
-	bs_write(stream, buffer, 11);
-	bs_write(stream, block, size);
-}
-
 static bool CheckBlockName(ByteStream *stream, const char *name, int &len)
 {
 	char	buffer[16];
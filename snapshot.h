@@ -9,12 +9,16 @@
 
 #include "snes9x.h"
 
-#define SNAPSHOT_MAGIC			"#!s9xsnp"
+#define SNAPSHOT_MAGIC			"#!s9xsnp"		// version 1, the block stream; read only
+#define SNAPSHOT_V2_MAGIC		"#!s9xsv2"		// version 2, fixed sections
 #define SNAPSHOT_VERSION_IRQ		7
 #define SNAPSHOT_VERSION_BAPU		8
 #define SNAPSHOT_VERSION_IRQ_2018	11		// irq changes were introduced earlier, since this we store NextIRQTimer directly
 #define SNAPSHOT_VERSION			14
 
+#define DELTA_MAGIC				"#!s9xdlt"
+#define DELTA_HEADER_SIZE		12		// magic, full snapshot size; records follow
+
 #define SUCCESS					1
 #define WRONG_FORMAT			(-1)
 #define WRONG_VERSION			(-2)
@@ -24,7 +28,30 @@ uint32 S9xFreezeSize (void);
 bool8 S9xFreezeGameMem (uint8 *,uint32);
 int S9xUnfreezeGameMem (const uint8 *,uint32);
 struct ByteStream;
-void S9xFreezeToStream (struct ByteStream *);
 int	 S9xUnfreezeFromStream (struct ByteStream *);
 
+// Delta snapshots. S9xDeltaBaseline names the state as it is now; save a full
+// snapshot at the same point to go with it. S9xFreezeDelta then writes what
+// has changed since that baseline as a patch over the baseline snapshot and
+// returns its length, or 0 if it did not fit; given somewhere to put it, it
+// also names the state as it is now, like S9xDeltaBaseline. S9xApplyDelta
+// patches a copy of the baseline snapshot into the later one, which loads as
+// usual.
+uint32 S9xDeltaBaseline (void);
+uint32 S9xFreezeDelta (uint8 *, uint32, uint32, uint32 * = NULL);
+bool8 S9xApplyDelta (uint8 *, uint32, const uint8 *, uint32);
+
+// A 64-bit fingerprint of everything S9xFreezeGameMem would save, for
+// spotting where two runs part ways. It rereads only the pages stamped since
+// it was last taken, so it is cheap enough for every frame. Equal states
+// hash equal within one build.
+uint64 S9xStateHash (void);
+
+// Raw snapshots: the state copied straight out of memory. Quicker still than
+// S9xFreezeGameMem, but good only within this process and only while the
+// same game stays loaded where it was; S9xUnfreezeRaw refuses anything else.
+uint32 S9xFreezeRawSize (void);
+bool8 S9xFreezeRaw (uint8 *, uint32);
+int S9xUnfreezeRaw (const uint8 *, uint32);
+
 #endif
@@ -227,6 +227,8 @@ struct SSettings
 	int32	Mode7Hires;				// 0 off, 2 = 2x, 4 = 4x Mode 7 hires
 	int32	Mode7HiresVertical;		// 2x vertical resample post-pass
 	int32	Mode7HiresBilinear;		// 0 nearest, 1 stable, 2 smooth
+	uint8	LayeredRenderer;		// two-phase renderer: 0 off, 1 on, 2 on and checked against the direct path
+	bool8	SkipDuplicateFrames;	// don't draw or present a frame identical to the last one
 	uint8	BG_Forced;
 	uint16  ForcedBackdrop;
 
@@ -260,6 +262,7 @@ struct SSettings
 	bool8	NoPatch;
 	bool8	IgnorePatchChecksum;
 	bool8	IsPatched;
+	bool8	ROMInfoCache;			// remember what loading a ROM file worked out (memmap.cpp)
 	int32	AutoSaveDelay;
 	bool8	DontSaveOopsSnapshot;
 	bool8	UpAndDown;
@@ -282,10 +285,10 @@ struct SSNESGameFixes
 
 void S9xMessage(int, int, const char *);
 
-extern struct SSettings			Settings;
-extern struct SCPUState			CPU;
-extern struct STimings			Timings;
-extern struct SSNESGameFixes	SNESGameFixes;
-extern char						String[513];
+extern S9X_TLS struct SSettings			Settings;
+extern S9X_TLS struct SCPUState			CPU;
+extern S9X_TLS struct STimings			Timings;
+extern S9X_TLS struct SSNESGameFixes	SNESGameFixes;
+extern S9X_TLS char						String[513];
 
 #endif
@@ -213,12 +213,12 @@
 #define FALSE 0
 #endif
 
-uint8_t  **SPC7110Map        = 0;
-uint8_t   *SPC7110ROM        = 0;
-uint32_t   SPC7110ROMSize    = 0;
-uint8_t    SPC7110RTCEnabled = 0;
+S9X_TLS uint8_t  **SPC7110Map        = 0;
+S9X_TLS uint8_t   *SPC7110ROM        = 0;
+S9X_TLS uint32_t   SPC7110ROMSize    = 0;
+S9X_TLS uint8_t    SPC7110RTCEnabled = 0;
 
-extern uint8_t OpenBus;
+extern S9X_TLS uint8_t OpenBus;
 
 /* Sentinel values written into SPC7110Map[]; must match the CMemory map
    enum in memmap.h (MAP_CPU = 0 base). */
@@ -235,16 +235,16 @@ extern uint8_t OpenBus;
 
 
 /*read() will spool chunks half the size of SPC7110_DECOMP_BUFFER_SIZE*/
-uint8_t* decomp_buffer;
+S9X_TLS uint8_t* decomp_buffer;
 
-static unsigned decomp_mode;
-static unsigned decomp_offset;
+static S9X_TLS unsigned decomp_mode;
+static S9X_TLS unsigned decomp_offset;
 
-static unsigned decomp_buffer_rdoffset;
-static unsigned decomp_buffer_wroffset;
-static unsigned decomp_buffer_length;
+static S9X_TLS unsigned decomp_buffer_rdoffset;
+static S9X_TLS unsigned decomp_buffer_wroffset;
+static S9X_TLS unsigned decomp_buffer_length;
 
-ContextState context[32];
+S9X_TLS ContextState context[32];
 
 #define memory_cartrom_read(a)		SPC7110ROM[(a)]
 #define memory_cartrtc_read(a)		RTCData.reg[(a)]
@@ -253,75 +253,75 @@ ContextState context[32];
 /*==================*/
 /*decompression unit*/
 /*==================*/
-uint8_t r4801; /*compression table low*/
-uint8_t r4802; /*compression table high*/
-uint8_t r4803; /*compression table bank*/
-uint8_t r4804; /*compression table index*/
-uint8_t r4805; /*decompression buffer index low*/
-uint8_t r4806; /*decompression buffer index high*/
-uint8_t r4807; /*???*/
-uint8_t r4808; /*???*/
-uint8_t r4809; /*compression length low*/
-uint8_t r480a; /*compression length high*/
-uint8_t r480b; /*decompression control register*/
-uint8_t r480c; /*decompression status*/
+S9X_TLS uint8_t r4801; /*compression table low*/
+S9X_TLS uint8_t r4802; /*compression table high*/
+S9X_TLS uint8_t r4803; /*compression table bank*/
+S9X_TLS uint8_t r4804; /*compression table index*/
+S9X_TLS uint8_t r4805; /*decompression buffer index low*/
+S9X_TLS uint8_t r4806; /*decompression buffer index high*/
+S9X_TLS uint8_t r4807; /*???*/
+S9X_TLS uint8_t r4808; /*???*/
+S9X_TLS uint8_t r4809; /*compression length low*/
+S9X_TLS uint8_t r480a; /*compression length high*/
+S9X_TLS uint8_t r480b; /*decompression control register*/
+S9X_TLS uint8_t r480c; /*decompression status*/
 
 /*==============*/
 /*data port unit*/
 /*==============*/
-uint8_t r4811; /*data pointer low*/
-uint8_t r4812; /*data pointer high*/
-uint8_t r4813; /*data pointer bank*/
-uint8_t r4814; /*data adjust low*/
-uint8_t r4815; /*data adjust high*/
-uint8_t r4816; /*data increment low*/
-uint8_t r4817; /*data increment high*/
-uint8_t r4818; /*data port control register*/
+S9X_TLS uint8_t r4811; /*data pointer low*/
+S9X_TLS uint8_t r4812; /*data pointer high*/
+S9X_TLS uint8_t r4813; /*data pointer bank*/
+S9X_TLS uint8_t r4814; /*data adjust low*/
+S9X_TLS uint8_t r4815; /*data adjust high*/
+S9X_TLS uint8_t r4816; /*data increment low*/
+S9X_TLS uint8_t r4817; /*data increment high*/
+S9X_TLS uint8_t r4818; /*data port control register*/
 
-uint8_t r481x;
+S9X_TLS uint8_t r481x;
 
-uint8_t r4814_latch;
-uint8_t r4815_latch;
+S9X_TLS uint8_t r4814_latch;
+S9X_TLS uint8_t r4815_latch;
 
 /*=========*/
 /*math unit*/
 /*=========*/
-uint8_t r4820; /*16-bit multiplicand B0, 32-bit dividend B0*/
-uint8_t r4821; /*16-bit multiplicand B1, 32-bit dividend B1*/
-uint8_t r4822; /*32-bit dividend B2*/
-uint8_t r4823; /*32-bit dividend B3*/
-uint8_t r4824; /*16-bit multiplier B0*/
-uint8_t r4825; /*16-bit multiplier B1*/
-uint8_t r4826; /*16-bit divisor B0*/
-uint8_t r4827; /*16-bit divisor B1*/
-uint8_t r4828; /*32-bit product B0, 32-bit quotient B0*/
-uint8_t r4829; /*32-bit product B1, 32-bit quotient B1*/
-uint8_t r482a; /*32-bit product B2, 32-bit quotient B2*/
-uint8_t r482b; /*32-bit product B3, 32-bit quotient B3*/
-uint8_t r482c; /*16-bit remainder B0*/
-uint8_t r482d; /*16-bit remainder B1*/
-uint8_t r482e; /*math control register*/
-uint8_t r482f; /*math status*/
+S9X_TLS uint8_t r4820; /*16-bit multiplicand B0, 32-bit dividend B0*/
+S9X_TLS uint8_t r4821; /*16-bit multiplicand B1, 32-bit dividend B1*/
+S9X_TLS uint8_t r4822; /*32-bit dividend B2*/
+S9X_TLS uint8_t r4823; /*32-bit dividend B3*/
+S9X_TLS uint8_t r4824; /*16-bit multiplier B0*/
+S9X_TLS uint8_t r4825; /*16-bit multiplier B1*/
+S9X_TLS uint8_t r4826; /*16-bit divisor B0*/
+S9X_TLS uint8_t r4827; /*16-bit divisor B1*/
+S9X_TLS uint8_t r4828; /*32-bit product B0, 32-bit quotient B0*/
+S9X_TLS uint8_t r4829; /*32-bit product B1, 32-bit quotient B1*/
+S9X_TLS uint8_t r482a; /*32-bit product B2, 32-bit quotient B2*/
+S9X_TLS uint8_t r482b; /*32-bit product B3, 32-bit quotient B3*/
+S9X_TLS uint8_t r482c; /*16-bit remainder B0*/
+S9X_TLS uint8_t r482d; /*16-bit remainder B1*/
+S9X_TLS uint8_t r482e; /*math control register*/
+S9X_TLS uint8_t r482f; /*math status*/
 
 /*===================*/
 /*memory mapping unit*/
 /*===================*/
-uint8_t r4830; /*SRAM write enable*/
-uint8_t r4831; /*$[d0-df]:[0000-ffff] mapping*/
-uint8_t r4832; /*$[e0-ef]:[0000-ffff] mapping*/
-uint8_t r4833; /*$[f0-ff]:[0000-ffff] mapping*/
-uint8_t r4834; /*???*/
+S9X_TLS uint8_t r4830; /*SRAM write enable*/
+S9X_TLS uint8_t r4831; /*$[d0-df]:[0000-ffff] mapping*/
+S9X_TLS uint8_t r4832; /*$[e0-ef]:[0000-ffff] mapping*/
+S9X_TLS uint8_t r4833; /*$[f0-ff]:[0000-ffff] mapping*/
+S9X_TLS uint8_t r4834; /*???*/
 
-unsigned dx_offset;
-unsigned ex_offset;
-unsigned fx_offset;
+S9X_TLS unsigned dx_offset;
+S9X_TLS unsigned ex_offset;
+S9X_TLS unsigned fx_offset;
 
 /*====================*/
 /*real-time clock unit*/
 /*====================*/
-uint8_t r4840; /*RTC latch*/
-uint8_t r4841; /*RTC index/data port*/
-uint8_t r4842; /*RTC status*/
+S9X_TLS uint8_t r4840; /*RTC latch*/
+S9X_TLS uint8_t r4841; /*RTC index/data port*/
+S9X_TLS uint8_t r4842; /*RTC status*/
 
 #define RTCS_INACTIVE 0
 #define RTCS_MODESELECT 1
@@ -330,9 +330,9 @@ uint8_t r4842; /*RTC status*/
 
 #define  RTCM_LINEAR 0x03
 #define RTCM_INDEXED 0x0c
-static uint32_t spc7110_rtc_mode;
-static uint32_t rtc_state;
-unsigned rtc_index;
+static S9X_TLS uint32_t spc7110_rtc_mode;
+static S9X_TLS uint32_t rtc_state;
+S9X_TLS unsigned rtc_index;
 
 /* Emulated-clock RTC tick accumulator.
  *
@@ -348,7 +348,7 @@ unsigned rtc_index;
  * then advance one emulated second every retro frame-worth of emulated
  * time. This is deterministic, fast-forward-immune, and savestate-safe,
  * matching the behaviour of ares'/bsnes' emulated-clock RTC. */
-static uint32_t spc7110_rtc_subframe;   /* frames accumulated toward 1 s */
+static S9X_TLS uint32_t spc7110_rtc_subframe;   /* frames accumulated toward 1 s */
 
 static const unsigned months[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
 
@@ -974,10 +974,10 @@ void spc7110_decomp_write(uint8_t data)
 static void spc7110_decomp_mode2(uint8_t init)
 {
 	unsigned i, pixel, data;
-	static unsigned pixelorder[16], realorder[16];
-	static uint8_t bitplanebuffer[16], buffer_index;
-	static uint8_t in, val, span;
-	static int out0, out1, inverts, lps, in_count;
+	static S9X_TLS unsigned pixelorder[16], realorder[16];
+	static S9X_TLS uint8_t bitplanebuffer[16], buffer_index;
+	static S9X_TLS uint8_t in, val, span;
+	static S9X_TLS int out0, out1, inverts, lps, in_count;
 
 	if(init == TRUE)
 	{
@@ -1105,9 +1105,9 @@ static void spc7110_decomp_mode2(uint8_t init)
 void spc7110_decomp_mode1(uint8_t init)
 {
 	unsigned i, bit, pixel, data;
-	static unsigned pixelorder[4], realorder[4];
-	static uint8_t in, val, span;
-	static int out, inverts, lps, in_count;
+	static S9X_TLS unsigned pixelorder[4], realorder[4];
+	static S9X_TLS uint8_t in, val, span;
+	static S9X_TLS int out, inverts, lps, in_count;
 
 	if(init == TRUE)
 	{
@@ -1217,8 +1217,8 @@ void spc7110_decomp_mode1(uint8_t init)
 static void spc7110_decomp_mode0(uint8_t init)
 {
 	unsigned bit;
-	static uint8_t val, in, span;
-	static int out, inverts, lps, in_count;
+	static S9X_TLS uint8_t val, in, span;
+	static S9X_TLS int out, inverts, lps, in_count;
 
 	if(init == TRUE)
 	{
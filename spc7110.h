@@ -186,15 +186,15 @@
 extern "C" {
 #endif
 
-extern uint8_t  **SPC7110Map;
-extern uint8_t   *SPC7110ROM;
-extern uint32_t   SPC7110ROMSize;
-extern uint8_t    SPC7110RTCEnabled;
+extern S9X_TLS uint8_t  **SPC7110Map;
+extern S9X_TLS uint8_t   *SPC7110ROM;
+extern S9X_TLS uint32_t   SPC7110ROMSize;
+extern S9X_TLS uint8_t    SPC7110RTCEnabled;
 
 /* Decompressor stream access for the S-CPU DMA special case (dma.cpp). */
 uint8_t spc7110_decomp_read (void);
-extern uint8_t r4809;
-extern uint8_t r480a;
+extern S9X_TLS uint8_t r4809;
+extern S9X_TLS uint8_t r480a;
 
 #define SPC7110_DECOMP_BUFFER_SIZE	64
 
@@ -282,7 +282,7 @@ struct SSPC7110Snapshot
 	ContextState context[32];
 };
 
-extern struct SSPC7110Snapshot	s7snap;
+extern S9X_TLS struct SSPC7110Snapshot	s7snap;
 
 void S9xInitSPC7110 (void);
 void S9xResetSPC7110 (void);
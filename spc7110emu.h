@@ -20,7 +20,7 @@
 
 #include "spc7110dec.h"
 
-extern uint8_t r4809; /* compression length low */
-extern uint8_t r480a; /* compression length high */
+extern S9X_TLS uint8_t r4809; /* compression length low */
+extern S9X_TLS uint8_t r480a; /* compression length high */
 
 #endif
@@ -197,13 +197,13 @@
 #define FALSE 0
 #endif
 
-uint8_t SRTCPalFlag = 0;
+S9X_TLS uint8_t SRTCPalFlag = 0;
 #ifndef min
 #define min(a, b) (((a) < (b)) ? (a) : (b))
 #define max(a, b) (((a) > (b)) ? (a) : (b))
 #endif
-extern uint8_t OpenBus;
-uint8_t SRTCEnabled = 0;
+extern S9X_TLS uint8_t OpenBus;
+S9X_TLS uint8_t SRTCEnabled = 0;
 
 
 #define MEMORY_CARTRTC_READ(a)		RTCData.reg[(a)]
@@ -214,9 +214,9 @@ uint8_t SRTCEnabled = 0;
 #define RTCM_READ	(2)
 #define RTCM_WRITE	(3)
 
-static signed srtc_index;
+static S9X_TLS signed srtc_index;
 
-static uint32_t srtc_mode;
+static S9X_TLS uint32_t srtc_mode;
 
 static const unsigned srtc_months[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
 
@@ -225,7 +225,7 @@ static const unsigned srtc_months[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31
  * on each $2800 read, tying the in-game clock to host wall-time. Instead
  * we seed once from the host at init, then tick on the emulated frame
  * clock: deterministic, fast-forward immune, and savestate-safe. */
-static uint32_t srtc_subframe;   /* frames accumulated toward 1 s */
+static S9X_TLS uint32_t srtc_subframe;   /* frames accumulated toward 1 s */
 
 /* Advance the S-RTC BCD registers (0-12) forward by `seconds`. Carry
  * cascade matches srtcemu_update_time (month = 1 digit at reg 8, year =
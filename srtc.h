@@ -186,8 +186,8 @@
 extern "C" {
 #endif
 
-extern uint8_t SRTCPalFlag;
-extern uint8_t SRTCEnabled;
+extern S9X_TLS uint8_t SRTCPalFlag;
+extern S9X_TLS uint8_t SRTCEnabled;
 
 struct SRTCData
 {
@@ -202,8 +202,8 @@ struct SSRTCSnapshot
 	uint32_t	rtc_subframe;	/* emulated-clock frame accumulator */
 };
 
-extern struct SRTCData		RTCData;
-extern struct SSRTCSnapshot	srtcsnap;
+extern S9X_TLS struct SRTCData		RTCData;
+extern S9X_TLS struct SSRTCSnapshot	srtcsnap;
 
 void S9xInitSRTC (void);
 void S9xResetSRTC (void);
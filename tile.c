@@ -204,14 +204,14 @@
 
 /* VRAM/FillRAM bridges set in S9xGraphicsInit (gfx.cpp); tile.c must not
    pull memmap.h (a C++ header) into a C translation unit. */
-extern uint8_t *tile_VRAM;
-extern uint8_t *tile_FillRAM;
+extern S9X_TLS uint8_t *tile_VRAM;
+extern S9X_TLS uint8_t *tile_FillRAM;
 
 /* Mode 7 hires ("HD Mode 7") option mirrors, refreshed by the C++ side
    before renderer selection. Dormant until the libretro option plumbing
    and wide-buffer geometry land; both default to off. */
-extern uint8_t TileMode7Hires;
-extern uint8_t TileMode7HiresBilinear;
+extern S9X_TLS uint8_t TileMode7Hires;
+extern S9X_TLS uint8_t TileMode7HiresBilinear;
 
 /* The HD texture-pack subsystem is 2010-only; renderer wrapping is a
    no-op here. */
@@ -912,10 +912,10 @@ static uint8_t ConvertTile2h_odd (uint8_t *pCache, uint32_t TileAddr, uint32_t T
 	uint8_t *tp1     = (uint8_t*)&tile_VRAM[TileAddr];
 	uint32_t *p       = (uint32_t *) pCache;
 	uint32_t non_zero = 0;
-   uint8_t *tp2 = tp1 + (1 << 4);
+   uint8_t *tp2 = (uint8_t*)&tile_VRAM[(TileAddr + (1 << 4)) & 0xffff];
 
 	if (Tile == 0x3ff)
-		tp2 = tp1 - (0x3ff << 4);
+		tp2 = (uint8_t*)&tile_VRAM[(TileAddr - (0x3ff << 4)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -943,10 +943,13 @@ static uint8_t ConvertTile4h_odd (uint8_t *pCache, uint32_t TileAddr, uint32_t T
 	uint32_t *p       = (uint32_t *) pCache;
 	uint32_t non_zero = 0;
 
+	/* The companion tile address wraps at the top of VRAM like every
+	   other PPU fetch; an unmasked pointer step here read up to 48 bytes
+	   past Memory.VRAM into the CMemory pointers behind it. */
 	if (Tile == 0x3ff)
-		tp2 -= (0x3ff << 5);
+		tp2 = (uint8_t*)&tile_VRAM[(TileAddr - (0x3ff << 5)) & 0xffff];
 	else
-		tp2 += (1 << 5);
+		tp2 = (uint8_t*)&tile_VRAM[(TileAddr + (1 << 5)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -982,10 +985,10 @@ static uint8_t ConvertTile2h_even (uint8_t *pCache, uint32_t TileAddr, uint32_t
 	uint8_t *tp1 = (uint8_t*)&tile_VRAM[TileAddr];
 	uint32_t *p       = (uint32_t *) pCache;
 	uint32_t non_zero = 0;
-   uint8_t *tp2 = tp1 + (1 << 4);
+   uint8_t *tp2 = (uint8_t*)&tile_VRAM[(TileAddr + (1 << 4)) & 0xffff];
 
 	if (Tile == 0x3ff)
-		tp2 = tp1 - (0x3ff << 4);
+		tp2 = (uint8_t*)&tile_VRAM[(TileAddr - (0x3ff << 4)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -1011,10 +1014,10 @@ static uint8_t ConvertTile4h_even (uint8_t *pCache, uint32_t TileAddr, uint32_t
 	uint8_t  *tp1     = (uint8_t*)&tile_VRAM[TileAddr];
 	uint32_t *p       = (uint32_t *) pCache;
 	uint32_t non_zero = 0;
-   uint8_t  *tp2     = tp1 + (1 << 5);
+   uint8_t  *tp2     = (uint8_t*)&tile_VRAM[(TileAddr + (1 << 5)) & 0xffff];
 
 	if (Tile == 0x3ff)
-		tp2 = tp1 - (0x3ff << 5);
+		tp2 = (uint8_t*)&tile_VRAM[(TileAddr - (0x3ff << 5)) & 0xffff];
 
 	for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 	{
@@ -1229,6 +1232,13 @@ static uint8_t ConvertTile4h_even (uint8_t *pCache, uint32_t TileAddr, uint32_t
         GFX.DB[Offset + 2 * N] = GFX.DB[Offset + 2 * N + 1] = GFX.Z2; \
     }
 
+/* Offset's column in its line. A tile scrolled partly off the left of the
+ * first line starts at a small negative Offset (wrapped, as a uint32);
+ * adding RealPPL first brings that back to the tail of the line above
+ * rather than to whatever 2^32 mod RealPPL happens to be. */
+#define LINE_OFFSET(Offset) \
+    (((Offset) + GFX.RealPPL) % GFX.RealPPL)
+
 /* True when a <=8 pixel run starting at OffsetInLine could contain a
  * subpixel equal to 0, GFX.RealPPL, or (SNES_WIDTH - 1) * 2. Conservative
  * by design; edge runs fall back to the exact per-pixel macro. */
@@ -3486,7 +3496,7 @@ static void DrawTile16_Hires (uint32_t Tile, uint32_t Offset, uint32_t StartLine
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -3570,7 +3580,7 @@ static void DrawTile16Add_Hires (uint32_t Tile, uint32_t Offset, uint32_t StartL
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -3654,7 +3664,7 @@ static void DrawTile16AddBrightness_Hires (uint32_t Tile, uint32_t Offset, uint3
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -3738,7 +3748,7 @@ static void DrawTile16AddF1_2_Hires (uint32_t Tile, uint32_t Offset, uint32_t St
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -3822,7 +3832,7 @@ static void DrawTile16AddS1_2_Hires (uint32_t Tile, uint32_t Offset, uint32_t St
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -3906,7 +3916,7 @@ static void DrawTile16AddS1_2Brightness_Hires (uint32_t Tile, uint32_t Offset, u
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -3990,7 +4000,7 @@ static void DrawTile16Sub_Hires (uint32_t Tile, uint32_t Offset, uint32_t StartL
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -4074,7 +4084,7 @@ static void DrawTile16SubF1_2_Hires (uint32_t Tile, uint32_t Offset, uint32_t St
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -4158,7 +4168,7 @@ static void DrawTile16SubS1_2_Hires (uint32_t Tile, uint32_t Offset, uint32_t St
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -4774,7 +4784,7 @@ static void DrawTile16_HiresInterlace (uint32_t Tile, uint32_t Offset, uint32_t
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -4858,7 +4868,7 @@ static void DrawTile16Add_HiresInterlace (uint32_t Tile, uint32_t Offset, uint32
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -4942,7 +4952,7 @@ static void DrawTile16AddBrightness_HiresInterlace (uint32_t Tile, uint32_t Offs
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -5026,7 +5036,7 @@ static void DrawTile16AddF1_2_HiresInterlace (uint32_t Tile, uint32_t Offset, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -5110,7 +5120,7 @@ static void DrawTile16AddS1_2_HiresInterlace (uint32_t Tile, uint32_t Offset, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -5194,7 +5204,7 @@ static void DrawTile16AddS1_2Brightness_HiresInterlace (uint32_t Tile, uint32_t
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -5278,7 +5288,7 @@ static void DrawTile16Sub_HiresInterlace (uint32_t Tile, uint32_t Offset, uint32
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -5362,7 +5372,7 @@ static void DrawTile16SubF1_2_HiresInterlace (uint32_t Tile, uint32_t Offset, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -5446,7 +5456,7 @@ static void DrawTile16SubS1_2_HiresInterlace (uint32_t Tile, uint32_t Offset, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (!(Tile & (V_FLIP | H_FLIP)))
     {
@@ -7365,7 +7375,7 @@ static void DrawClippedTile16_Hires (uint32_t Tile, uint32_t Offset, uint32_t St
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -7456,7 +7466,7 @@ static void DrawClippedTile16Add_Hires (uint32_t Tile, uint32_t Offset, uint32_t
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -7547,7 +7557,7 @@ static void DrawClippedTile16AddBrightness_Hires (uint32_t Tile, uint32_t Offset
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -7638,7 +7648,7 @@ static void DrawClippedTile16AddF1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -7729,7 +7739,7 @@ static void DrawClippedTile16AddS1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -7820,7 +7830,7 @@ static void DrawClippedTile16AddS1_2Brightness_Hires (uint32_t Tile, uint32_t Of
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -7911,7 +7921,7 @@ static void DrawClippedTile16Sub_Hires (uint32_t Tile, uint32_t Offset, uint32_t
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -8002,7 +8012,7 @@ static void DrawClippedTile16SubF1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -8093,7 +8103,7 @@ static void DrawClippedTile16SubS1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -8707,7 +8717,7 @@ static void DrawClippedTile16_HiresInterlace (uint32_t Tile, uint32_t Offset, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -8798,7 +8808,7 @@ static void DrawClippedTile16Add_HiresInterlace (uint32_t Tile, uint32_t Offset,
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -8889,7 +8899,7 @@ static void DrawClippedTile16AddBrightness_HiresInterlace (uint32_t Tile, uint32
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -8980,7 +8990,7 @@ static void DrawClippedTile16AddF1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -9071,7 +9081,7 @@ static void DrawClippedTile16AddS1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -9162,7 +9172,7 @@ static void DrawClippedTile16AddS1_2Brightness_HiresInterlace (uint32_t Tile, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -9253,7 +9263,7 @@ static void DrawClippedTile16Sub_HiresInterlace (uint32_t Tile, uint32_t Offset,
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -9344,7 +9354,7 @@ static void DrawClippedTile16SubF1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -9435,7 +9445,7 @@ static void DrawClippedTile16SubS1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     endpix = StartPixel + Width;
     if (endpix > 8) endpix = 8;
@@ -10294,7 +10304,7 @@ static void DrawMosaicPixel16_Hires (uint32_t Tile, uint32_t Offset, uint32_t St
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10330,7 +10340,7 @@ static void DrawMosaicPixel16Add_Hires (uint32_t Tile, uint32_t Offset, uint32_t
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10366,7 +10376,7 @@ static void DrawMosaicPixel16AddBrightness_Hires (uint32_t Tile, uint32_t Offset
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10402,7 +10412,7 @@ static void DrawMosaicPixel16AddF1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10438,7 +10448,7 @@ static void DrawMosaicPixel16AddS1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10474,7 +10484,7 @@ static void DrawMosaicPixel16AddS1_2Brightness_Hires (uint32_t Tile, uint32_t Of
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10510,7 +10520,7 @@ static void DrawMosaicPixel16Sub_Hires (uint32_t Tile, uint32_t Offset, uint32_t
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10546,7 +10556,7 @@ static void DrawMosaicPixel16SubF1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10582,7 +10592,7 @@ static void DrawMosaicPixel16SubS1_2_Hires (uint32_t Tile, uint32_t Offset, uint
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10862,7 +10872,7 @@ static void DrawMosaicPixel16_HiresInterlace (uint32_t Tile, uint32_t Offset, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10898,7 +10908,7 @@ static void DrawMosaicPixel16Add_HiresInterlace (uint32_t Tile, uint32_t Offset,
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10934,7 +10944,7 @@ static void DrawMosaicPixel16AddBrightness_HiresInterlace (uint32_t Tile, uint32
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -10970,7 +10980,7 @@ static void DrawMosaicPixel16AddF1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -11006,7 +11016,7 @@ static void DrawMosaicPixel16AddS1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -11042,7 +11052,7 @@ static void DrawMosaicPixel16AddS1_2Brightness_HiresInterlace (uint32_t Tile, ui
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -11078,7 +11088,7 @@ static void DrawMosaicPixel16Sub_HiresInterlace (uint32_t Tile, uint32_t Offset,
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -11114,7 +11124,7 @@ static void DrawMosaicPixel16SubF1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -11150,7 +11160,7 @@ static void DrawMosaicPixel16SubS1_2_HiresInterlace (uint32_t Tile, uint32_t Off
     if (IS_BLANK_TILE())
         return;
     SELECT_PALETTE();
-    OffsetInLine = Offset % GFX.RealPPL;
+    OffsetInLine = LINE_OFFSET(Offset);
     hires_edge = HIRES_EDGE_RUN();
     if (Tile & H_FLIP)
         StartPixel = 7 - StartPixel;
@@ -12975,7 +12985,7 @@ static void (*Renderers_DrawBackdrop16Hires[9]) (uint32_t, uint32_t, uint32_t) =
 
 #define CLIP_10_BIT_SIGNED(a)	(((a) & 0x2000) ? ((a) | ~0x3ff) : ((a) & 0x3ff))
 
-extern struct SLineMatrixData	LineMatrixData[240];
+extern S9X_TLS struct SLineMatrixData	LineMatrixData[240];
 
 /* High-resolution Mode 7 with bilinear filtering: same output rate
    as the nearest-neighbour HR family (de-templated below), but
@@ -13638,28 +13648,42 @@ static INLINE int m7hr_blend_stable(uint8_t p_tl, uint8_t p_tr, uint8_t p_bl, ui
  * sub-screen-side pixel uses a swapped operand order so the
  * subscreen pixel at +2N+2 acts as the "subscreen" for the
  * main pixel at +2N+1 (see PPU/CGADSUB hires-math notes in the
- * non-Mode-7 plotter). N is unparenthesized; see M7N_PIXEL_N1x1. */
-/* Anomie placement; N is absolute x, see DRAW_PIXEL_H2x1. */
-#define M7N_PIXEL_H2x1(N, M, MATH_SELECTOR, MATH_OP, Z_EXPR) \
-    if ((Z_EXPR) > GFX.DB[Offset + 2 * N] && (M)) \
+ * non-Mode-7 plotter). */
+/* Anomie placement, see DRAW_PIXEL_H2x1. O is the output index and C
+ * the pair's column in the line (2 * x); the edge tests need C, since
+ * the mosaic bodies fold the block row into O. */
+#define M7_PIXEL_H2x1_AT(O, C, M, MATH_SELECTOR, MATH_OP, Z_EXPR) \
+    if ((Z_EXPR) > GFX.DB[O] && (M)) \
     { \
-        GFX.S[Offset + 2 * N + 1] = MATH_SELECTOR(MATH_OP, \
+        GFX.S[(O) + 1] = MATH_SELECTOR(MATH_OP, \
             GFX.ScreenColors[Pix], \
-            GFX.SubScreen[Offset + 2 * N], \
-            GFX.SubZBuffer[Offset + 2 * N]); \
-        if ((2 * N) != (SNES_WIDTH - 1) << 1) \
-            GFX.S[Offset + 2 * N + 2] = MATH_SELECTOR(MATH_OP, \
-                (GFX.ClipColors ? 0 : GFX.SubScreen[Offset + 2 * N + 2]), \
+            GFX.SubScreen[O], \
+            GFX.SubZBuffer[O]); \
+        if ((C) != (SNES_WIDTH - 1) << 1) \
+            GFX.S[(O) + 2] = MATH_SELECTOR(MATH_OP, \
+                (GFX.ClipColors ? 0 : GFX.SubScreen[(O) + 2]), \
                 GFX.RealScreenColors[Pix], \
-                GFX.SubZBuffer[Offset + 2 * N]); \
-        if ((2 * N) == 0 || (2 * N) == GFX.RealPPL) \
-            GFX.S[Offset + 2 * N] = MATH_SELECTOR(MATH_OP, \
-                (GFX.ClipColors ? 0 : GFX.SubScreen[Offset + 2 * N]), \
+                GFX.SubZBuffer[O]); \
+        if ((C) == 0) \
+            GFX.S[O] = MATH_SELECTOR(MATH_OP, \
+                (GFX.ClipColors ? 0 : GFX.SubScreen[O]), \
                 GFX.RealScreenColors[Pix], \
-                GFX.SubZBuffer[Offset + 2 * N]); \
-        GFX.DB[Offset + 2 * N] = GFX.DB[Offset + 2 * N + 1] = (Z_EXPR); \
+                GFX.SubZBuffer[O]); \
+        GFX.DB[O] = GFX.DB[(O) + 1] = (Z_EXPR); \
     }
 
+/* N is absolute x. */
+#define M7N_PIXEL_H2x1(N, M, MATH_SELECTOR, MATH_OP, Z_EXPR) \
+    M7_PIXEL_H2x1_AT(Offset + 2 * (N), 2 * (N), M, MATH_SELECTOR, MATH_OP, Z_EXPR)
+
+/* Mosaic form: W is absolute x, H the row within the block. Handing it
+ * W + H * GFX.PPL as N, the way the other mosaic plotters take it, put
+ * the row into the edge tests: from the third row of a block down x == 0
+ * was never written and kept whatever the buffer last held, and the last
+ * column wrote its sub pixel over x == 0 of the row below. */
+#define M7M_PIXEL_H2x1(W, H, M, MATH_SELECTOR, MATH_OP, Z_EXPR) \
+    M7_PIXEL_H2x1_AT(Offset + 2 * (W) + (H) * GFX.PPL, 2 * (W), M, MATH_SELECTOR, MATH_OP, Z_EXPR)
+
 /* Per-function bodies: explicit, fully inlined ----------------
  *
  * Each function below is a complete native Mode 7 line renderer for
@@ -13684,27 +13708,38 @@ static INLINE int m7hr_blend_stable(uint8_t p_tl, uint8_t p_tr, uint8_t p_bl, ui
 /* Mode 7 stores its tilemap in the even VRAM bytes and the character
  * graphics in the odd bytes, so the two per-pixel gathers stride by 2
  * and every 64-byte cache line they pull is 50% wasted on the other
- * plane.  De-interleave VRAM into two contiguous planes once per Mode 7
- * frame: the tilemap gather then streams a packed 16 KB plane and each
- * character's 64 graphics bytes become one contiguous cache line instead
- * of straddling two.
+ * plane.  De-interleave VRAM into two contiguous planes: the tilemap
+ * gather then streams a packed 16 KB plane and each character's 64
+ * graphics bytes become one contiguous cache line instead of straddling
+ * two.
  *
- * Planes are rebuilt from authoritative VRAM at the top of every
- * DrawBackgroundMode7 (S9xMode7DeinterleaveVRAM).  VRAM is only safely
- * written during VBlank/forced-blank, so it is stable across a frame's
- * Mode 7 rendering and the snapshot can never be stale within a rendered
- * region.  No VRAM-write hooks; ~3 us per rebuild. */
-static uint8_t Mode7TileMap[0x8000];
-static uint8_t Mode7Gfx[0x8000];
-
-void S9xMode7DeinterleaveVRAM (void)
+ * Planes are brought up to date from authoritative VRAM at the top of
+ * every DrawBackgroundMode7 (S9xMode7DeinterleaveVRAM), a 256-byte VRAM
+ * page at a time: cached[] holds a flag per page, cleared by STORE_VRAM
+ * when a byte changes and by snapshot loads (S9xInvalidateVRAMChanges),
+ * and only the pages whose flag is clear are copied again.  VRAM is only
+ * safely written during VBlank/forced-blank, so it is stable across a
+ * frame's Mode 7 rendering and the planes can never be stale within a
+ * rendered region. */
+static S9X_TLS uint8_t Mode7TileMap[0x8000];
+static S9X_TLS uint8_t Mode7Gfx[0x8000];
+
+void S9xMode7DeinterleaveVRAM (uint8 *cached)
 {
 	const uint8_t *v = tile_VRAM;
-	int i;
-	for (i = 0; i < 0x8000; i++)
+	int page, i;
+	for (page = 0; page < 0x100; page++)
 	{
-		Mode7TileMap[i] = v[(i << 1)];
-		Mode7Gfx[i]     = v[(i << 1) + 1];
+		if (cached[page])
+			continue;
+
+		for (i = page << 7; i < (page + 1) << 7; i++)
+		{
+			Mode7TileMap[i] = v[(i << 1)];
+			Mode7Gfx[i]     = v[(i << 1) + 1];
+		}
+
+		cached[page] = TRUE;
 	}
 }
 
@@ -13717,6 +13752,212 @@ void S9xMode7DeinterleaveVRAM (void)
  *          b    = Mode7Gfx[(M7tn<<6)+((Y&7)<<3)+(X&7)];
  *          fill = Mode7Gfx[((Y&7)<<3)+(X&7)]; */
 
+/* Mode 7 span sampler --------------------------------------------
+ *
+ * The HD Mode 7 renderers (HR, HR4X, BL, BL4X, BL1X) take one to four
+ * samples per native pixel along a single affine line.  Rather than
+ * walk AA/CC one sub-sample at a time inside every (BG, math) body,
+ * each line is first sampled into a span buffer here, and the bodies
+ * only run their Z-test / colour-math write over the result.
+ *
+ * Sample s of a span with F samples per pixel sits at
+ *     X0 + (s / F) * aa + (s % F) * (aa / F)
+ * which is exactly where the old incremental walk landed (sub-steps
+ * of aa/F, with the last one absorbing the rounding leftover), so the
+ * output is unchanged.  The position is closed-form per lane, so eight
+ * lanes are stepped at once by (8 / F) * aa.
+ *
+ * m7_span_coords() stores the raw 16.8 positions for the bilinear
+ * families, which need the fraction.  m7_span_texels() goes on to
+ * derive the tilemap / character indices in the same lanes and stores
+ * the nearest texel byte, 0 where Mode7Repeat 1/2 clips the sample
+ * (0 is transparent for both BG1 and BG2, so clipped and transparent
+ * samples need no separate flag).  SSE2 and NEON have no gather, so
+ * the two dependent plane reads stay scalar; only the addressing is
+ * vectorised. */
+#define M7_SPAN_MAX MAX_SNES_WIDTH_4X
+
+static S9X_TLS int32_t M7SpanX[M7_SPAN_MAX];
+static S9X_TLS int32_t M7SpanY[M7_SPAN_MAX];
+static S9X_TLS uint8_t M7SpanTexel[M7_SPAN_MAX];
+
+static INLINE int32_t m7_span_offset (int s, int d, int F)
+{
+	return (int32_t) ((uint32_t) (s / F) * (uint32_t) d + (uint32_t) (s % F) * (uint32_t) (d / F));
+}
+
+static INLINE uint8_t m7_span_texel (int32_t Xf, int32_t Yf)
+{
+	int X = Xf >> 8;
+	int Y = Yf >> 8;
+
+	if (!PPU.Mode7Repeat)
+	{
+		X &= 0x3ff;
+		Y &= 0x3ff;
+	}
+	else if ((X | Y) & ~0x3ff)
+		return (PPU.Mode7Repeat == 3) ? Mode7Gfx[((Y & 7) << 3) + (X & 7)] : 0;
+
+	return Mode7Gfx[(Mode7TileMap[((Y & ~7) << 4) + (X >> 3)] << 6) + ((Y & 7) << 3) + (X & 7)];
+}
+
+static void m7_span_coords (int32_t X0, int32_t Y0, int aa, int cc, int F, int n)
+{
+	int s = 0;
+
+	n *= F;
+#if defined(TILE_HAVE_SSE2)
+	{
+		__m128i x0 = _mm_set_epi32(X0 + m7_span_offset(3, aa, F), X0 + m7_span_offset(2, aa, F),
+		                           X0 + m7_span_offset(1, aa, F), X0);
+		__m128i y0 = _mm_set_epi32(Y0 + m7_span_offset(3, cc, F), Y0 + m7_span_offset(2, cc, F),
+		                           Y0 + m7_span_offset(1, cc, F), Y0);
+		__m128i dx4 = _mm_set1_epi32(m7_span_offset(4, aa, F));
+		__m128i dy4 = _mm_set1_epi32(m7_span_offset(4, cc, F));
+		__m128i dx8 = _mm_set1_epi32(m7_span_offset(8, aa, F));
+		__m128i dy8 = _mm_set1_epi32(m7_span_offset(8, cc, F));
+
+		for (; s + 8 <= n; s += 8)
+		{
+			_mm_storeu_si128((__m128i *) (M7SpanX + s),     x0);
+			_mm_storeu_si128((__m128i *) (M7SpanX + s + 4), _mm_add_epi32(x0, dx4));
+			_mm_storeu_si128((__m128i *) (M7SpanY + s),     y0);
+			_mm_storeu_si128((__m128i *) (M7SpanY + s + 4), _mm_add_epi32(y0, dy4));
+			x0 = _mm_add_epi32(x0, dx8);
+			y0 = _mm_add_epi32(y0, dy8);
+		}
+	}
+#elif defined(TILE_HAVE_NEON)
+	{
+		int32_t lx[4] = { X0, X0 + m7_span_offset(1, aa, F), X0 + m7_span_offset(2, aa, F), X0 + m7_span_offset(3, aa, F) };
+		int32_t ly[4] = { Y0, Y0 + m7_span_offset(1, cc, F), Y0 + m7_span_offset(2, cc, F), Y0 + m7_span_offset(3, cc, F) };
+		int32x4_t x0 = vld1q_s32(lx);
+		int32x4_t y0 = vld1q_s32(ly);
+		int32x4_t dx4 = vdupq_n_s32(m7_span_offset(4, aa, F));
+		int32x4_t dy4 = vdupq_n_s32(m7_span_offset(4, cc, F));
+		int32x4_t dx8 = vdupq_n_s32(m7_span_offset(8, aa, F));
+		int32x4_t dy8 = vdupq_n_s32(m7_span_offset(8, cc, F));
+
+		for (; s + 8 <= n; s += 8)
+		{
+			vst1q_s32(M7SpanX + s,     x0);
+			vst1q_s32(M7SpanX + s + 4, vaddq_s32(x0, dx4));
+			vst1q_s32(M7SpanY + s,     y0);
+			vst1q_s32(M7SpanY + s + 4, vaddq_s32(y0, dy4));
+			x0 = vaddq_s32(x0, dx8);
+			y0 = vaddq_s32(y0, dy8);
+		}
+	}
+#endif
+	/* Remainder (and the whole span without SIMD): the plain walk.
+	 * s is a multiple of 8 here, so it starts on a pixel boundary. */
+	if (s < n)
+	{
+		uint32_t x = (uint32_t) X0 + (uint32_t) m7_span_offset(s, aa, F);
+		uint32_t y = (uint32_t) Y0 + (uint32_t) m7_span_offset(s, cc, F);
+		int sub = 0;
+
+		for (; s < n; s++)
+		{
+			M7SpanX[s] = (int32_t) x;
+			M7SpanY[s] = (int32_t) y;
+			if (++sub < F)
+			{
+				x += aa / F;
+				y += cc / F;
+			}
+			else
+			{
+				sub = 0;
+				x += aa - (F - 1) * (aa / F);
+				y += cc - (F - 1) * (cc / F);
+			}
+		}
+	}
+}
+
+static void m7_span_texels (int32_t X0, int32_t Y0, int aa, int cc, int F, int n)
+{
+	int s = 0;
+
+	m7_span_coords(X0, Y0, aa, cc, F, n);
+	n *= F;
+#if defined(TILE_HAVE_SSE2) || defined(TILE_HAVE_NEON)
+	{
+		int32_t tv[8], pv[8];
+		int repeat = PPU.Mode7Repeat, fill = (PPU.Mode7Repeat == 3);
+		int i;
+
+		for (; s + 8 <= n; s += 8)
+		{
+			for (i = 0; i < 8; i += 4)
+			{
+#if defined(TILE_HAVE_SSE2)
+				__m128i X = _mm_srai_epi32(_mm_loadu_si128((const __m128i *) (M7SpanX + s + i)), 8);
+				__m128i Y = _mm_srai_epi32(_mm_loadu_si128((const __m128i *) (M7SpanY + s + i)), 8);
+				__m128i k7 = _mm_set1_epi32(7);
+				__m128i p, t;
+
+				if (!repeat)
+				{
+					X = _mm_and_si128(X, _mm_set1_epi32(0x3ff));
+					Y = _mm_and_si128(Y, _mm_set1_epi32(0x3ff));
+				}
+				p = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(Y, k7), 3), _mm_and_si128(X, k7));
+				t = _mm_add_epi32(_mm_slli_epi32(_mm_andnot_si128(k7, Y), 4), _mm_srli_epi32(X, 3));
+				if (repeat)
+				{
+					/* Out-of-range lanes get tile index -1. */
+					__m128i out = _mm_cmpeq_epi32(_mm_andnot_si128(_mm_set1_epi32(0x3ff), _mm_or_si128(X, Y)),
+					                              _mm_setzero_si128());
+					t = _mm_or_si128(_mm_and_si128(out, t), _mm_andnot_si128(out, _mm_set1_epi32(-1)));
+				}
+				_mm_storeu_si128((__m128i *) (tv + i), t);
+				_mm_storeu_si128((__m128i *) (pv + i), p);
+#else
+				int32x4_t X = vshrq_n_s32(vld1q_s32(M7SpanX + s + i), 8);
+				int32x4_t Y = vshrq_n_s32(vld1q_s32(M7SpanY + s + i), 8);
+				int32x4_t k7 = vdupq_n_s32(7);
+				int32x4_t p, t;
+
+				if (!repeat)
+				{
+					X = vandq_s32(X, vdupq_n_s32(0x3ff));
+					Y = vandq_s32(Y, vdupq_n_s32(0x3ff));
+				}
+				p = vorrq_s32(vshlq_n_s32(vandq_s32(Y, k7), 3), vandq_s32(X, k7));
+				t = vaddq_s32(vshlq_n_s32(vbicq_s32(Y, k7), 4),
+				              vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(X), 3)));
+				if (repeat)
+				{
+					/* Out-of-range lanes get tile index -1. */
+					uint32x4_t in = vceqq_s32(vbicq_s32(vorrq_s32(X, Y), vdupq_n_s32(0x3ff)), vdupq_n_s32(0));
+					t = vbslq_s32(in, t, vdupq_n_s32(-1));
+				}
+				vst1q_s32(tv + i, t);
+				vst1q_s32(pv + i, p);
+#endif
+			}
+
+			if (!repeat)
+			{
+				for (i = 0; i < 8; i++)
+					M7SpanTexel[s + i] = Mode7Gfx[(Mode7TileMap[tv[i]] << 6) + pv[i]];
+			}
+			else
+			{
+				for (i = 0; i < 8; i++)
+					M7SpanTexel[s + i] = (tv[i] >= 0) ? Mode7Gfx[(Mode7TileMap[tv[i]] << 6) + pv[i]]
+					                   : fill ? Mode7Gfx[pv[i]] : 0;
+			}
+		}
+	}
+#endif
+	for (; s < n; s++)
+		M7SpanTexel[s] = m7_span_texel(M7SpanX[s], M7SpanY[s]);
+}
+
 /* DrawMode7BG1 NAME2 = Normal1x1: 7 math variants. */
 static void DrawMode7BG1_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
@@ -20411,7 +20652,7 @@ static void DrawMode7MosaicBG1_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + 7)))
                     }
                 }
             }
@@ -20442,7 +20683,7 @@ static void DrawMode7MosaicBG1_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + 7)))
                     }
                 }
             }
@@ -20537,7 +20778,7 @@ static void DrawMode7MosaicBG1Add_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + 7)))
                     }
                 }
             }
@@ -20568,7 +20809,7 @@ static void DrawMode7MosaicBG1Add_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + 7)))
                     }
                 }
             }
@@ -20663,7 +20904,7 @@ static void DrawMode7MosaicBG1AddBrightness_Hires (uint32_t Left, uint32_t Right
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + 7)))
                     }
                 }
             }
@@ -20694,7 +20935,7 @@ static void DrawMode7MosaicBG1AddBrightness_Hires (uint32_t Left, uint32_t Right
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + 7)))
                     }
                 }
             }
@@ -20789,7 +21030,7 @@ static void DrawMode7MosaicBG1AddF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + 7)))
                     }
                 }
             }
@@ -20820,7 +21061,7 @@ static void DrawMode7MosaicBG1AddF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + 7)))
                     }
                 }
             }
@@ -20915,7 +21156,7 @@ static void DrawMode7MosaicBG1AddS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + 7)))
                     }
                 }
             }
@@ -20946,7 +21187,7 @@ static void DrawMode7MosaicBG1AddS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + 7)))
                     }
                 }
             }
@@ -21041,7 +21282,7 @@ static void DrawMode7MosaicBG1AddS1_2Brightness_Hires (uint32_t Left, uint32_t R
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + 7)))
                     }
                 }
             }
@@ -21072,7 +21313,7 @@ static void DrawMode7MosaicBG1AddS1_2Brightness_Hires (uint32_t Left, uint32_t R
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + 7)))
                     }
                 }
             }
@@ -21167,7 +21408,7 @@ static void DrawMode7MosaicBG1Sub_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + 7)))
                     }
                 }
             }
@@ -21198,7 +21439,7 @@ static void DrawMode7MosaicBG1Sub_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + 7)))
                     }
                 }
             }
@@ -21293,7 +21534,7 @@ static void DrawMode7MosaicBG1SubF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + 7)))
                     }
                 }
             }
@@ -21324,7 +21565,7 @@ static void DrawMode7MosaicBG1SubF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + 7)))
                     }
                 }
             }
@@ -21419,7 +21660,7 @@ static void DrawMode7MosaicBG1SubS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + 7)))
                     }
                 }
             }
@@ -21450,7 +21691,7 @@ static void DrawMode7MosaicBG1SubS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + 7)))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + 7)))
                     }
                 }
             }
@@ -23741,7 +23982,7 @@ static void DrawMode7MosaicBG2_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -23772,7 +24013,7 @@ static void DrawMode7MosaicBG2_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), NOMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -23861,7 +24102,7 @@ static void DrawMode7MosaicBG2Add_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -23892,7 +24133,7 @@ static void DrawMode7MosaicBG2Add_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -23981,7 +24222,7 @@ static void DrawMode7MosaicBG2AddBrightness_Hires (uint32_t Left, uint32_t Right
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24012,7 +24253,7 @@ static void DrawMode7MosaicBG2AddBrightness_Hires (uint32_t Left, uint32_t Right
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24101,7 +24342,7 @@ static void DrawMode7MosaicBG2AddF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24132,7 +24373,7 @@ static void DrawMode7MosaicBG2AddF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24221,7 +24462,7 @@ static void DrawMode7MosaicBG2AddS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24252,7 +24493,7 @@ static void DrawMode7MosaicBG2AddS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24341,7 +24582,7 @@ static void DrawMode7MosaicBG2AddS1_2Brightness_Hires (uint32_t Left, uint32_t R
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24372,7 +24613,7 @@ static void DrawMode7MosaicBG2AddS1_2Brightness_Hires (uint32_t Left, uint32_t R
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, ADD_BRIGHTNESS, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24461,7 +24702,7 @@ static void DrawMode7MosaicBG2Sub_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24492,7 +24733,7 @@ static void DrawMode7MosaicBG2Sub_Hires (uint32_t Left, uint32_t Right, int D)
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), REGMATH, SUB, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24581,7 +24822,7 @@ static void DrawMode7MosaicBG2SubF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24612,7 +24853,7 @@ static void DrawMode7MosaicBG2SubF1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHF1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24701,7 +24942,7 @@ static void DrawMode7MosaicBG2SubS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24732,7 +24973,7 @@ static void DrawMode7MosaicBG2SubS1_2_Hires (uint32_t Left, uint32_t Right, int
                     for ( h = MosaicStart; h < VMosaic; h++)
                     {
                         for ( w = x + HMosaic - 1; w >= x; w--)
-                            M7N_PIXEL_H2x1(w + h * GFX.PPL, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
+                            M7M_PIXEL_H2x1(w, h, (w >= (int32_t) Left && w < (int32_t) Right), MATHS1_2, SUB, ((D + ((b & 0x80) ? 11 : 3))))
                     }
                 }
             }
@@ -24808,7 +25049,7 @@ static void DrawMode7BG1HR_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -24851,120 +25092,25 @@ static void DrawMode7BG1HR_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = NOMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = NOMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = NOMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = NOMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = NOMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -24974,7 +25120,7 @@ static void DrawMode7BG1HRAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -25017,120 +25163,25 @@ static void DrawMode7BG1HRAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = REGMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = REGMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = REGMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = REGMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -25140,7 +25191,7 @@ static void DrawMode7BG1HRAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -25183,130 +25234,35 @@ static void DrawMode7BG1HRAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = REGMATH(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = REGMATH(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
+    }
+}
 
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = REGMATH(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = REGMATH(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-    }
-}
-
-static void DrawMode7BG1HRAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int D)
-{
-    struct SLineMatrixData *l;
-    uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+static void DrawMode7BG1HRAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int D)
+{
+    struct SLineMatrixData *l;
+    uint32_t x, Line, Offset;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -25349,120 +25305,25 @@ static void DrawMode7BG1HRAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHF1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHF1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHF1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -25472,7 +25333,7 @@ static void DrawMode7BG1HRAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -25515,120 +25376,25 @@ static void DrawMode7BG1HRAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHS1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHS1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -25638,7 +25404,7 @@ static void DrawMode7BG1HRAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -25681,120 +25447,25 @@ static void DrawMode7BG1HRAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHS1_2(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHS1_2(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -25804,7 +25475,7 @@ static void DrawMode7BG1HRSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -25847,120 +25518,25 @@ static void DrawMode7BG1HRSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = REGMATH(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = REGMATH(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = REGMATH(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = REGMATH(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = REGMATH(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -25970,7 +25546,7 @@ static void DrawMode7BG1HRSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -26013,120 +25589,25 @@ static void DrawMode7BG1HRSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHF1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHF1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHF1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -26136,7 +25617,7 @@ static void DrawMode7BG1HRSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -26179,120 +25660,25 @@ static void DrawMode7BG1HRSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHS1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + 7));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0xff)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHS1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + 7));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + 7)) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0xff)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + 7));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHS1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -26317,7 +25703,7 @@ static void DrawMode7BG2HR_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -26354,120 +25740,25 @@ static void DrawMode7BG2HR_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = NOMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = NOMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = NOMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = NOMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = NOMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -26477,7 +25768,7 @@ static void DrawMode7BG2HRAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -26514,120 +25805,25 @@ static void DrawMode7BG2HRAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = REGMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = REGMATH(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = REGMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = REGMATH(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -26637,7 +25833,7 @@ static void DrawMode7BG2HRAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -26674,130 +25870,35 @@ static void DrawMode7BG2HRAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = REGMATH(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = REGMATH(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = REGMATH(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = REGMATH(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-    }
-}
+    }
+}
 
 static void DrawMode7BG2HRAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -26834,120 +25935,25 @@ static void DrawMode7BG2HRAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHF1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHF1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHF1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -26957,7 +25963,7 @@ static void DrawMode7BG2HRAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -26994,120 +26000,25 @@ static void DrawMode7BG2HRAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHS1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                        ADD,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHS1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                            ADD,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -27117,7 +26028,7 @@ static void DrawMode7BG2HRAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -27154,120 +26065,25 @@ static void DrawMode7BG2HRAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHS1_2(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                        ADD_BRIGHTNESS,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHS1_2(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                            ADD_BRIGHTNESS,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -27277,7 +26093,7 @@ static void DrawMode7BG2HRSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -27314,120 +26130,25 @@ static void DrawMode7BG2HRSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = REGMATH(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = REGMATH(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = REGMATH(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = REGMATH(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = REGMATH(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -27437,7 +26158,7 @@ static void DrawMode7BG2HRSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -27474,120 +26195,25 @@ static void DrawMode7BG2HRSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHF1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHF1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHF1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+                GFX.S[Offset + idx] = MATHF1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -27597,7 +26223,7 @@ static void DrawMode7BG2HRSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -27634,120 +26260,25 @@ static void DrawMode7BG2HRSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
-        AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
-        CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
-
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x] = MATHS1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x],
-                        GFX.SubZBuffer[Offset + 2 * x]);
-                    GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa_h; CC += cc_h;
-
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8) & 0x3ff;
-                Y = ((CC + DD) >> 8) & 0x3ff;
-                M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                    && (Pix = (b & 0x7f)))
-                {
-                    GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                        SUB,
-                        GFX.ScreenColors[Pix],
-                        GFX.SubScreen[Offset + 2 * x + 1],
-                        GFX.SubZBuffer[Offset + 2 * x + 1]);
-                    GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y;
-                uint8_t b; uint32_t M7tn;
-                int do_draw;
-
-                /* Sample 1 -> output index 2*x */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x] = MATHS1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x],
-                            GFX.SubZBuffer[Offset + 2 * x]);
-                        GFX.DB[Offset + 2 * x] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa_h; CC += cc_h;
+        AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
+        CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-                /* Sample 2 -> output index 2*x + 1 */
-                X = ((AA + BB) >> 8);
-                Y = ((CC + DD) >> 8);
-                do_draw = 1;
-                if (((X | Y) & ~0x3ff) == 0)
-                {
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                }
-                else if (PPU.Mode7Repeat == 3)
-                    b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                else
-                    do_draw = 0;
-                if (do_draw)
-                {
-                    if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + 2 * x + 1]
-                        && (Pix = (b & 0x7f)))
-                    {
-                        GFX.S[Offset + 2 * x + 1] = MATHS1_2(
-                            SUB,
-                            GFX.ScreenColors[Pix],
-                            GFX.SubScreen[Offset + 2 * x + 1],
-                            GFX.SubZBuffer[Offset + 2 * x + 1]);
-                        GFX.DB[Offset + 2 * x + 1] = ((D + ((b & 0x80) ? 11 : 3)));
-                    }
-                }
-                AA += aa - aa_h; CC += cc - cc_h;
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+        for (x = 0; x < 2 * (Right - Left); x++)
+        {
+            uint32_t idx = 2 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
+            {
+                GFX.S[Offset + idx] = MATHS1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -27818,7 +26349,7 @@ static void DrawMode7BG1HR4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -27861,102 +26392,25 @@ static void DrawMode7BG1HR4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = NOMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = NOMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = NOMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -27966,7 +26420,7 @@ static void DrawMode7BG1HR4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -28009,102 +26463,25 @@ static void DrawMode7BG1HR4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -28114,7 +26491,7 @@ static void DrawMode7BG1HR4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -28157,102 +26534,25 @@ static void DrawMode7BG1HR4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -28262,7 +26562,7 @@ static void DrawMode7BG1HR4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -28305,102 +26605,25 @@ static void DrawMode7BG1HR4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHF1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -28410,7 +26633,7 @@ static void DrawMode7BG1HR4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -28453,102 +26676,25 @@ static void DrawMode7BG1HR4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -28558,7 +26704,7 @@ static void DrawMode7BG1HR4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -28601,102 +26747,25 @@ static void DrawMode7BG1HR4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -28706,7 +26775,7 @@ static void DrawMode7BG1HR4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -28749,102 +26818,25 @@ static void DrawMode7BG1HR4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = REGMATH(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -28854,7 +26846,7 @@ static void DrawMode7BG1HR4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -28897,102 +26889,25 @@ static void DrawMode7BG1HR4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
-        xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
-        AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
-        CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
-
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
+        AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
+        CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
+
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHF1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -29002,7 +26917,7 @@ static void DrawMode7BG1HR4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     if ((tile_FillRAM[0x2130] & 1))
@@ -29045,102 +26960,25 @@ static void DrawMode7BG1HR4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0xff);
-                    /* Z-test + write. (D + 7) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + 7)) > GFX.DB[Offset + idx] && (Pix = (b & 0xff)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0xff);
-                        if (((D + 7)) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + 7));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHS1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + 7));
             }
         }
     }
@@ -29169,7 +27007,7 @@ static void DrawMode7BG2HR4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -29206,102 +27044,25 @@ static void DrawMode7BG2HR4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = NOMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = NOMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = NOMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -29311,7 +27072,7 @@ static void DrawMode7BG2HR4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -29348,102 +27109,25 @@ static void DrawMode7BG2HR4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -29453,7 +27137,7 @@ static void DrawMode7BG2HR4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -29490,102 +27174,25 @@ static void DrawMode7BG2HR4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = REGMATH(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -29595,7 +27202,7 @@ static void DrawMode7BG2HR4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -29632,102 +27239,25 @@ static void DrawMode7BG2HR4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHF1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -29737,7 +27267,7 @@ static void DrawMode7BG2HR4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -29774,102 +27304,25 @@ static void DrawMode7BG2HR4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -29879,7 +27332,7 @@ static void DrawMode7BG2HR4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -29916,102 +27369,25 @@ static void DrawMode7BG2HR4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                ADD_BRIGHTNESS,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHS1_2(
+                    ADD_BRIGHTNESS,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -30021,7 +27397,7 @@ static void DrawMode7BG2HR4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -30058,102 +27434,25 @@ static void DrawMode7BG2HR4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
-        AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
-        CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
-
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
+        CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
+
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = REGMATH(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = REGMATH(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -30163,7 +27462,7 @@ static void DrawMode7BG2HR4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -30200,102 +27499,25 @@ static void DrawMode7BG2HR4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHF1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHF1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -30305,7 +27527,7 @@ static void DrawMode7BG2HR4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
 {
     struct SLineMatrixData *l;
     uint32_t x, Line, Offset;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
 
     GFX.RealScreenColors = IPPU.ScreenColors;
     GFX.ScreenColors = GFX.ClipColors ? BlackColourMap : GFX.RealScreenColors;
@@ -30342,102 +27564,25 @@ static void DrawMode7BG2HR4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-        if (!PPU.Mode7Repeat)
-        {
-            /* Wrap path: X & Y mask to 10 bits, no clipping. */
-            for (x = Left; x < Right; x++)
-            {
-                int X, Y, sub;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8) & 0x3ff;
-                    Y = ((CC + DD) >> 8) & 0x3ff;
-                    M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                    b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    Pix = (b & 0x7f);
-                    /* Z-test + write. (D + ((b & 0x80) ? 11 : 3)) may reference 'b' (BG2). */
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    /* Quarter-step. Final sub-sample absorbs the
-                     * rounding leftover so the total advance equals
-                     * aa/cc per native pixel. */
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
-            }
-        }
-        else
+        /* Sample the whole line into the span buffer, then Z-test
+         * and write each sub-sample. */
+        m7_span_texels(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+        for (x = 0; x < 4 * (Right - Left); x++)
         {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
+            uint32_t idx = 4 * Left + x;
+            uint8_t b = M7SpanTexel[x];
+            if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && (Pix = (b & 0x7f)))
             {
-                int X, Y, sub, do_draw;
-                uint8_t b; uint32_t M7tn;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    X = ((AA + BB) >> 8);
-                    Y = ((CC + DD) >> 8);
-                    do_draw = 1;
-                    if (((X | Y) & ~0x3ff) == 0)
-                    {
-                        M7tn = Mode7TileMap[((Y & ~7) << 4) + (X >> 3)];
-                        b = Mode7Gfx[(M7tn << 6) + ((Y & 7) << 3) + (X & 7)];
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                        b = Mode7Gfx[((Y & 7) << 3) + (X & 7)];
-                    else
-                        do_draw = 0;
-                    if (do_draw)
-                    {
-                        uint32_t idx = 4 * x + sub;
-                        Pix = (b & 0x7f);
-                        if (((D + ((b & 0x80) ? 11 : 3))) > GFX.DB[Offset + idx] && Pix)
-                        {
-                            GFX.S[Offset + idx] = MATHS1_2(
-                                SUB,
-                                GFX.ScreenColors[Pix],
-                                GFX.SubScreen[Offset + idx],
-                                GFX.SubZBuffer[Offset + idx]);
-                            GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
-                        }
-                    }
-                    if (sub < 3)
-                    {
-                        AA += aa_q;
-                        CC += cc_q;
-                    }
-                    else
-                    {
-                        AA += aa - 3 * aa_q;
-                        CC += cc - 3 * cc_q;
-                    }
-                }
+                GFX.S[Offset + idx] = MATHS1_2(
+                    SUB,
+                    GFX.ScreenColors[Pix],
+                    GFX.SubScreen[Offset + idx],
+                    GFX.SubZBuffer[Offset + idx]);
+                GFX.DB[Offset + idx] = ((D + ((b & 0x80) ? 11 : 3)));
             }
         }
     }
@@ -30522,7 +27667,7 @@ static void DrawMode7BG1BL_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -30565,88 +27710,53 @@ static void DrawMode7BG1BL_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     NOMATH, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    NOMATH, ADD,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        NOMATH, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        NOMATH, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -30658,7 +27768,7 @@ static void DrawMode7BG1BLAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -30701,88 +27811,53 @@ static void DrawMode7BG1BLAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    REGMATH, ADD,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     REGMATH, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -30794,7 +27869,7 @@ static void DrawMode7BG1BLAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -30837,88 +27912,53 @@ static void DrawMode7BG1BLAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     REGMATH, ADD_BRIGHTNESS,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    REGMATH, ADD_BRIGHTNESS,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD_BRIGHTNESS,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD_BRIGHTNESS,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -30930,7 +27970,7 @@ static void DrawMode7BG1BLAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -30973,88 +28013,53 @@ static void DrawMode7BG1BLAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    MATHF1_2, ADD,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHF1_2, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -31066,7 +28071,7 @@ static void DrawMode7BG1BLAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -31109,88 +28114,53 @@ static void DrawMode7BG1BLAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHS1_2, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    MATHS1_2, ADD,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -31202,7 +28172,7 @@ static void DrawMode7BG1BLAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -31245,88 +28215,53 @@ static void DrawMode7BG1BLAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    MATHS1_2, ADD_BRIGHTNESS,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHS1_2, ADD_BRIGHTNESS,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD_BRIGHTNESS,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD_BRIGHTNESS,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -31338,7 +28273,7 @@ static void DrawMode7BG1BLSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -31381,88 +28316,53 @@ static void DrawMode7BG1BLSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     REGMATH, SUB,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    REGMATH, SUB,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -31474,7 +28374,7 @@ static void DrawMode7BG1BLSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -31517,88 +28417,53 @@ static void DrawMode7BG1BLSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    MATHF1_2, SUB,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHF1_2, SUB,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
-            }
-        }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
-                uint8_t p_tl, p_tr, p_bl, p_br;
-                uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+            }
+        }
+        else
+        {
+            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
+             * or fill with tile 0 (mode 3). */
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -31610,7 +28475,7 @@ static void DrawMode7BG1BLSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -31653,88 +28518,53 @@ static void DrawMode7BG1BLSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHS1_2, SUB,
                     ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0xff,
-                    MATHS1_2, SUB,
-                    ((D + 7)), ((D + 7)), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -31761,7 +28591,7 @@ static void DrawMode7BG2BL_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -31798,88 +28628,53 @@ static void DrawMode7BG2BL_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    NOMATH, ADD,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     NOMATH, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        NOMATH, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        NOMATH, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -31891,7 +28686,7 @@ static void DrawMode7BG2BLAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -31928,88 +28723,53 @@ static void DrawMode7BG2BLAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     REGMATH, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    REGMATH, ADD,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32021,7 +28781,7 @@ static void DrawMode7BG2BLAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -32058,88 +28818,53 @@ static void DrawMode7BG2BLAddBrightness_Normal1x1 (uint32_t Left, uint32_t Right
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    REGMATH, ADD_BRIGHTNESS,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     REGMATH, ADD_BRIGHTNESS,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD_BRIGHTNESS,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, ADD_BRIGHTNESS,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32151,7 +28876,7 @@ static void DrawMode7BG2BLAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -32188,88 +28913,53 @@ static void DrawMode7BG2BLAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHF1_2, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    MATHF1_2, ADD,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32281,7 +28971,7 @@ static void DrawMode7BG2BLAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -32318,88 +29008,53 @@ static void DrawMode7BG2BLAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    MATHS1_2, ADD,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHS1_2, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32411,7 +29066,7 @@ static void DrawMode7BG2BLAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -32448,88 +29103,53 @@ static void DrawMode7BG2BLAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t R
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHS1_2, ADD_BRIGHTNESS,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    MATHS1_2, ADD_BRIGHTNESS,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD_BRIGHTNESS,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, ADD_BRIGHTNESS,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32541,7 +29161,7 @@ static void DrawMode7BG2BLSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -32578,88 +29198,53 @@ static void DrawMode7BG2BLSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    REGMATH, SUB,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     REGMATH, SUB,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        REGMATH, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32671,7 +29256,7 @@ static void DrawMode7BG2BLSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -32708,88 +29293,53 @@ static void DrawMode7BG2BLSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHF1_2, SUB,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    MATHF1_2, SUB,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHF1_2, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32801,7 +29351,7 @@ static void DrawMode7BG2BLSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_h, cc_h, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -32838,88 +29388,53 @@ static void DrawMode7BG2BLSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, int
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_h = aa / 2;
-        cc_h = cc / 2;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 2, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 2 * (Right - Left); x++)
             {
-                M7HR_SAMPLE_BILINEAR(2 * x,     AA + BB, CC + DD,
-                    VRAM1, 0x7f,
-                    MATHS1_2, SUB,
-                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa_h; CC += cc_h;
-                M7HR_SAMPLE_BILINEAR(2 * x + 1, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(2 * Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHS1_2, SUB,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int X1 = (AA + BB) >> 8;
-                int Y1 = (CC + DD) >> 8;
-                int X2, Y2;
-                uint32_t Xf1 = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yf1 = (uint32_t)((CC + DD) & 0xff);
-                uint32_t Xf2, Yf2;
+            for (x = 0; x < 2 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
-                /* Sample 1 -> output 2*x */
-                if (((X1 | Y1) & ~0x3ff) == 0)
-                {
-                    M7HR_LOOKUP_4(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                  b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                else if (PPU.Mode7Repeat == 3)
-                {
-                    M7HR_LOOKUP_4_FILL(X1, Y1, p_tl, p_tr, p_bl, p_br,
-                                       b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf1, Yf1,
-                        MATHS1_2, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                }
-                /* else: clip - leave pixel untouched (transparent) */
-                AA += aa_h; CC += cc_h;
-                /* Sample 2 -> output 2*x + 1 */
-                X2  = (AA + BB) >> 8;
-                Y2  = (CC + DD) >> 8;
-                Xf2 = (uint32_t)((AA + BB) & 0xff);
-                Yf2 = (uint32_t)((CC + DD) & 0xff);
-                if (((X2 | Y2) & ~0x3ff) == 0)
+                if (((Xs | Ys) & ~0x3ff) == 0)
                 {
-                    M7HR_LOOKUP_4(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
                 else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_LOOKUP_4_FILL(X2, Y2, p_tl, p_tr, p_bl, p_br,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(2 * x + 1,
-                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xf2, Yf2,
+                    M7HR_BLEND_AND_WRITE(2 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
-                AA += aa - aa_h; CC += cc - cc_h;
             }
         }
     }
@@ -32990,7 +29505,7 @@ static void DrawMode7BG1BL4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33033,64 +29548,52 @@ static void DrawMode7BG1BL4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    NOMATH, ADD,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
+            }
+        }
+        else
+        {
+            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
+             * or fill with tile 0 (mode 3). */
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        NOMATH, ADD,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
-            }
-        }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            NOMATH, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            NOMATH, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
                 }
             }
         }
@@ -33103,7 +29606,7 @@ static void DrawMode7BG1BL4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33146,64 +29649,52 @@ static void DrawMode7BG1BL4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
-                        REGMATH, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    REGMATH, ADD,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
                 }
             }
         }
@@ -33216,7 +29707,7 @@ static void DrawMode7BG1BL4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33259,64 +29750,52 @@ static void DrawMode7BG1BL4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
-                        REGMATH, ADD_BRIGHTNESS,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    REGMATH, ADD_BRIGHTNESS,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD_BRIGHTNESS,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD_BRIGHTNESS,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD_BRIGHTNESS,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD_BRIGHTNESS,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
                 }
             }
         }
@@ -33329,7 +29808,7 @@ static void DrawMode7BG1BL4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33372,64 +29851,52 @@ static void DrawMode7BG1BL4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
-                        MATHF1_2, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    MATHF1_2, ADD,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, ADD,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, ADD,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
                 }
             }
         }
@@ -33442,7 +29909,7 @@ static void DrawMode7BG1BL4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33485,64 +29952,52 @@ static void DrawMode7BG1BL4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
-                        MATHS1_2, ADD,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    MATHS1_2, ADD,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
                 }
             }
         }
@@ -33555,7 +30010,7 @@ static void DrawMode7BG1BL4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33598,64 +30053,52 @@ static void DrawMode7BG1BL4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
-                        MATHS1_2, ADD_BRIGHTNESS,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    MATHS1_2, ADD_BRIGHTNESS,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD_BRIGHTNESS,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD_BRIGHTNESS,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD_BRIGHTNESS,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD_BRIGHTNESS,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
                 }
             }
         }
@@ -33668,7 +30111,7 @@ static void DrawMode7BG1BL4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33711,64 +30154,52 @@ static void DrawMode7BG1BL4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
-                        REGMATH, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    REGMATH, SUB,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, SUB,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, SUB,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, SUB,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, SUB,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
                 }
             }
         }
@@ -33781,7 +30212,7 @@ static void DrawMode7BG1BL4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33824,64 +30255,52 @@ static void DrawMode7BG1BL4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
-                        MATHF1_2, SUB,
-                        ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    MATHF1_2, SUB,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, SUB,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, SUB,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, SUB,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, SUB,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
                 }
             }
         }
@@ -33894,7 +30313,7 @@ static void DrawMode7BG1BL4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -33937,64 +30356,52 @@ static void DrawMode7BG1BL4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0xff,
+                    MATHS1_2, SUB,
+                    ((D + 7)), ((D + 7)), Offset, smooth);
+            }
+        }
+        else
+        {
+            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
+             * or fill with tile 0 (mode 3). */
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, SUB,
+                        ((D + 7)), ((D + 7)), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
                 {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0xff,
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0xff);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
-            }
-        }
-        else
-        {
-            /* Repeat-mode path: clip out-of-range samples (modes 1/2)
-             * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, SUB,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0xff);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, SUB,
-                            ((D + 7)), ((D + 7)), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
                 }
             }
         }
@@ -34023,7 +30430,7 @@ static void DrawMode7BG2BL4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34060,64 +30467,52 @@ static void DrawMode7BG2BL4X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        NOMATH, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    NOMATH, ADD,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            NOMATH, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            NOMATH, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        NOMATH, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        NOMATH, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34130,7 +30525,7 @@ static void DrawMode7BG2BL4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34167,64 +30562,52 @@ static void DrawMode7BG2BL4XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        REGMATH, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    REGMATH, ADD,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34237,7 +30620,7 @@ static void DrawMode7BG2BL4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34274,64 +30657,52 @@ static void DrawMode7BG2BL4XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        REGMATH, ADD_BRIGHTNESS,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    REGMATH, ADD_BRIGHTNESS,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD_BRIGHTNESS,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, ADD_BRIGHTNESS,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD_BRIGHTNESS,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, ADD_BRIGHTNESS,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34344,7 +30715,7 @@ static void DrawMode7BG2BL4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34381,64 +30752,52 @@ static void DrawMode7BG2BL4XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        MATHF1_2, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    MATHF1_2, ADD,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34451,7 +30810,7 @@ static void DrawMode7BG2BL4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34488,64 +30847,52 @@ static void DrawMode7BG2BL4XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        MATHS1_2, ADD,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    MATHS1_2, ADD,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34558,7 +30905,7 @@ static void DrawMode7BG2BL4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34595,64 +30942,52 @@ static void DrawMode7BG2BL4XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        MATHS1_2, ADD_BRIGHTNESS,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    MATHS1_2, ADD_BRIGHTNESS,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD_BRIGHTNESS,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, ADD_BRIGHTNESS,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD_BRIGHTNESS,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, ADD_BRIGHTNESS,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34665,7 +31000,7 @@ static void DrawMode7BG2BL4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34702,64 +31037,52 @@ static void DrawMode7BG2BL4XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        REGMATH, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    REGMATH, SUB,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, SUB,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            REGMATH, SUB,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, SUB,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        REGMATH, SUB,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34772,7 +31095,7 @@ static void DrawMode7BG2BL4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34809,64 +31132,52 @@ static void DrawMode7BG2BL4XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        MATHF1_2, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    MATHF1_2, SUB,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, SUB,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHF1_2, SUB,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, SUB,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHF1_2, SUB,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -34879,7 +31190,7 @@ static void DrawMode7BG2BL4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
     uint32_t x, Line, Offset;
     uint8_t *VRAM  = tile_VRAM;
     uint8_t *VRAM1 = VRAM + 1;
-    int aa, cc, aa_q, cc_q, startx;
+    int aa, cc, startx;
     uint8_t smooth = (TileMode7HiresBilinear == 2);
 
     GFX.RealScreenColors = IPPU.ScreenColors;
@@ -34916,64 +31227,52 @@ static void DrawMode7BG2BL4XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
             aa = l->MatrixA;
             cc = l->MatrixC;
         }
-        aa_q = aa / 4;
-        cc_q = cc / 4;
         xx = CLIP_10_BIT_SIGNED(HOffset - CentreX);
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 4, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++)
+            for (x = 0; x < 4 * (Right - Left); x++)
             {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    M7HR_SAMPLE_BILINEAR(4 * x + sub, AA + BB, CC + DD,
-                        VRAM1, 0x7f,
-                        MATHS1_2, SUB,
-                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
-                }
+                M7HR_SAMPLE_BILINEAR(4 * Left + x, M7SpanX[x], M7SpanY[x],
+                    VRAM1, 0x7f,
+                    MATHS1_2, SUB,
+                    ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
             }
         }
         else
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++)
-            {
-                int sub;
-                for (sub = 0; sub < 4; sub++)
-                {
-                    int Xs = (AA + BB) >> 8;
-                    int Ys = (CC + DD) >> 8;
-                    uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                    uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
-                    uint8_t p_tl, p_tr, p_bl, p_br;
-                    uint8_t b_tl_raw_;
-                    if (((Xs | Ys) & ~0x3ff) == 0)
-                    {
-                        M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                      b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, SUB,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    else if (PPU.Mode7Repeat == 3)
-                    {
-                        M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
-                                           b_tl_raw_, VRAM1, 0x7f);
-                        M7HR_BLEND_AND_WRITE(4 * x + sub,
-                            p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
-                            MATHS1_2, SUB,
-                            ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
-                    }
-                    if (sub < 3) { AA += aa_q;          CC += cc_q;          }
-                    else         { AA += aa - 3 * aa_q; CC += cc - 3 * cc_q; }
+            for (x = 0; x < 4 * (Right - Left); x++)
+            {
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
+                uint8_t p_tl, p_tr, p_bl, p_br;
+                uint8_t b_tl_raw_;
+                if (((Xs | Ys) & ~0x3ff) == 0)
+                {
+                    M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                  b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, SUB,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
+                }
+                else if (PPU.Mode7Repeat == 3)
+                {
+                    M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
+                                       b_tl_raw_, VRAM1, 0x7f);
+                    M7HR_BLEND_AND_WRITE(4 * Left + x,
+                        p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
+                        MATHS1_2, SUB,
+                        ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
                 }
             }
         }
@@ -35091,12 +31390,14 @@ static void DrawMode7BG1BL1X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     NOMATH, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35106,19 +31407,19 @@ static void DrawMode7BG1BL1X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35127,7 +31428,7 @@ static void DrawMode7BG1BL1X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35190,12 +31491,14 @@ static void DrawMode7BG1BL1XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     REGMATH, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35205,19 +31508,19 @@ static void DrawMode7BG1BL1XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35226,7 +31529,7 @@ static void DrawMode7BG1BL1XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35289,12 +31592,14 @@ static void DrawMode7BG1BL1XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     REGMATH, ADD_BRIGHTNESS,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35304,19 +31609,19 @@ static void DrawMode7BG1BL1XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35325,7 +31630,7 @@ static void DrawMode7BG1BL1XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35388,12 +31693,14 @@ static void DrawMode7BG1BL1XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHF1_2, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35403,19 +31710,19 @@ static void DrawMode7BG1BL1XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35424,7 +31731,7 @@ static void DrawMode7BG1BL1XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35487,12 +31794,14 @@ static void DrawMode7BG1BL1XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHS1_2, ADD,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35502,19 +31811,19 @@ static void DrawMode7BG1BL1XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35523,7 +31832,7 @@ static void DrawMode7BG1BL1XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35586,12 +31895,14 @@ static void DrawMode7BG1BL1XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHS1_2, ADD_BRIGHTNESS,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35601,19 +31912,19 @@ static void DrawMode7BG1BL1XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35622,7 +31933,7 @@ static void DrawMode7BG1BL1XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35685,12 +31996,14 @@ static void DrawMode7BG1BL1XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     REGMATH, SUB,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35700,19 +32013,19 @@ static void DrawMode7BG1BL1XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35721,7 +32034,7 @@ static void DrawMode7BG1BL1XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35784,12 +32097,14 @@ static void DrawMode7BG1BL1XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHF1_2, SUB,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35799,19 +32114,19 @@ static void DrawMode7BG1BL1XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35820,7 +32135,7 @@ static void DrawMode7BG1BL1XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35883,12 +32198,14 @@ static void DrawMode7BG1BL1XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0xff,
                     MATHS1_2, SUB,
                     ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35898,19 +32215,19 @@ static void DrawMode7BG1BL1XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35919,7 +32236,7 @@ static void DrawMode7BG1BL1XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0xff);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + 7)), ((D + 7)), Offset, smooth);
@@ -35991,12 +32308,14 @@ static void DrawMode7BG2BL1X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     NOMATH, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36006,19 +32325,19 @@ static void DrawMode7BG2BL1X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36027,7 +32346,7 @@ static void DrawMode7BG2BL1X_Normal1x1 (uint32_t Left, uint32_t Right, int D)
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         NOMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36084,12 +32403,14 @@ static void DrawMode7BG2BL1XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     REGMATH, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36099,19 +32420,19 @@ static void DrawMode7BG2BL1XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36120,7 +32441,7 @@ static void DrawMode7BG2BL1XAdd_Normal1x1 (uint32_t Left, uint32_t Right, int D)
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36177,12 +32498,14 @@ static void DrawMode7BG2BL1XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     REGMATH, ADD_BRIGHTNESS,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36192,19 +32515,19 @@ static void DrawMode7BG2BL1XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36213,7 +32536,7 @@ static void DrawMode7BG2BL1XAddBrightness_Normal1x1 (uint32_t Left, uint32_t Rig
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36270,12 +32593,14 @@ static void DrawMode7BG2BL1XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHF1_2, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36285,19 +32610,19 @@ static void DrawMode7BG2BL1XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36306,7 +32631,7 @@ static void DrawMode7BG2BL1XAddF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36363,12 +32688,14 @@ static void DrawMode7BG2BL1XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHS1_2, ADD,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36378,19 +32705,19 @@ static void DrawMode7BG2BL1XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36399,7 +32726,7 @@ static void DrawMode7BG2BL1XAddS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36456,12 +32783,14 @@ static void DrawMode7BG2BL1XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHS1_2, ADD_BRIGHTNESS,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36471,19 +32800,19 @@ static void DrawMode7BG2BL1XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36492,7 +32821,7 @@ static void DrawMode7BG2BL1XAddS1_2Brightness_Normal1x1 (uint32_t Left, uint32_t
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, ADD_BRIGHTNESS,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36549,12 +32878,14 @@ static void DrawMode7BG2BL1XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     REGMATH, SUB,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36564,19 +32895,19 @@ static void DrawMode7BG2BL1XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36585,7 +32916,7 @@ static void DrawMode7BG2BL1XSub_Normal1x1 (uint32_t Left, uint32_t Right, int D)
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         REGMATH, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36642,12 +32973,14 @@ static void DrawMode7BG2BL1XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHF1_2, SUB,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36657,19 +32990,19 @@ static void DrawMode7BG2BL1XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36678,7 +33011,7 @@ static void DrawMode7BG2BL1XSubF1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHF1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36735,12 +33068,14 @@ static void DrawMode7BG2BL1XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
         CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
+        m7_span_coords(AA + BB, CC + DD, aa, cc, 1, Right - Left);
+
         if (!PPU.Mode7Repeat)
         {
             /* Wrap path. */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                M7HR_SAMPLE_BILINEAR(x, AA + BB, CC + DD,
+                M7HR_SAMPLE_BILINEAR(Left + x, M7SpanX[x], M7SpanY[x],
                     VRAM1, 0x7f,
                     MATHS1_2, SUB,
                     ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36750,19 +33085,19 @@ static void DrawMode7BG2BL1XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
         {
             /* Repeat-mode path: clip out-of-range samples (modes 1/2)
              * or fill with tile 0 (mode 3). */
-            for (x = Left; x < Right; x++, AA += aa, CC += cc)
+            for (x = 0; x < Right - Left; x++)
             {
-                int Xs = (AA + BB) >> 8;
-                int Ys = (CC + DD) >> 8;
-                uint32_t Xfs = (uint32_t)((AA + BB) & 0xff);
-                uint32_t Yfs = (uint32_t)((CC + DD) & 0xff);
+                int Xs = M7SpanX[x] >> 8;
+                int Ys = M7SpanY[x] >> 8;
+                uint32_t Xfs = (uint32_t)(M7SpanX[x] & 0xff);
+                uint32_t Yfs = (uint32_t)(M7SpanY[x] & 0xff);
                 uint8_t p_tl, p_tr, p_bl, p_br;
                 uint8_t b_tl_raw_;
                 if (((Xs | Ys) & ~0x3ff) == 0)
                 {
                     M7HR_LOOKUP_4(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                   b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36771,7 +33106,7 @@ static void DrawMode7BG2BL1XSubS1_2_Normal1x1 (uint32_t Left, uint32_t Right, in
                 {
                     M7HR_LOOKUP_4_FILL(Xs, Ys, p_tl, p_tr, p_bl, p_br,
                                        b_tl_raw_, VRAM1, 0x7f);
-                    M7HR_BLEND_AND_WRITE(x,
+                    M7HR_BLEND_AND_WRITE(Left + x,
                         p_tl, p_tr, p_bl, p_br, b_tl_raw_, Xfs, Yfs,
                         MATHS1_2, SUB,
                         ((D + ((b & 0x80) ? 11 : 3))), ((D + ((b & 0x80) ? 11 : 3))), Offset, smooth);
@@ -36798,22 +33133,299 @@ static void (*Renderers_DrawMode7BG2BL1XNormal1x1[9]) (uint32_t, uint32_t, int)
  * ==================================================================== */
 
 /* ====================================================================
- * Dispatch helpers: select renderer pointers based on PPU state
- * ==================================================================== */
+ * Two-phase (layered) renderer
+ * ====================================================================
+ *
+ * Phase 1 plotters. Selected by S9xSelectTileRenderers in place of
+ * the Normal1x1 families while GFX.Layered is set; RenderScreen has
+ * pointed GFX.S / GFX.DB / GFX.LF at the native-width layer rows and
+ * GFX.PPL at SNES_WIDTH. Same Z test and depth store as the direct
+ * plotters, but instead of resolving color math they keep the
+ * winning pixel's colour (RealScreenColors -- the clip-to-black is
+ * deferred too) and record LAYER_* flags for the compositor.
+ *
+ * The colour is stored resolved rather than as a palette index:
+ * CGRAM and master brightness may change between the band being
+ * drawn and the line being composited.
+ *
+ * Math and Nomath variants differ only in LAYER_MATH. Backdrop keeps
+ * the direct contract (Z = 1 wherever DB is still 0). */
 
+#define LAYER_CLIP	0x01	/* colour window forced the main colour to black */
+#define LAYER_MATH	0x02	/* color math applies to this pixel */
 
-/* Functions to select which converter and renderer to use. */
+#define DRAW_PIXEL_LAYERED(N, M) \
+    if (GFX.Z1 > GFX.DB[Offset + N] && (M)) \
+    { \
+        GFX.S[Offset + N] = GFX.RealScreenColors[Pix]; \
+        GFX.LF[Offset + N] = Flags; \
+        GFX.DB[Offset + N] = GFX.Z2; \
+    }
 
-void S9xSelectTileRenderers_SFXSpeedup (void)
+static INLINE void DrawTile16Layered (uint32_t Tile, uint32_t Offset, uint32_t StartLine, uint32_t LineCount, uint8_t Flags)
 {
-	int i;
-	GFX.LinesPerTile = 8;
+    uint8_t *pCache, *bp, Pix, n;
+    int32_t l, bp_step;
+    GET_CACHED_TILE();
+    if (IS_BLANK_TILE())
+        return;
+    SELECT_PALETTE();
+    if (GFX.ClipColors)
+        Flags |= LAYER_CLIP;
+    if (!(Tile & V_FLIP))
+    {
+        bp = pCache + StartLine;
+        bp_step = 8;
+    }
+    else
+    {
+        bp = pCache + 56 - StartLine;
+        bp_step = -8;
+    }
+    for (l = LineCount; l > 0; l--, bp += bp_step, Offset += GFX.PPL)
+    {
+        if (!(Tile & H_FLIP))
+        {
+            for (n = 0; n < 8; n++)
+                DRAW_PIXEL_LAYERED(n, Pix = bp[n])
+        }
+        else
+        {
+            for (n = 0; n < 8; n++)
+                DRAW_PIXEL_LAYERED(n, Pix = bp[7 - n])
+        }
+    }
+}
 
-	GFX.DrawTileNomath        = Renderers_DrawTile16Normal1x1[0];
-	GFX.DrawClippedTileNomath = Renderers_DrawClippedTile16Normal1x1[0];
-	GFX.DrawBackdropNomath    = Renderers_DrawBackdrop16Normal1x1[0];
+static INLINE void DrawClippedTile16Layered (uint32_t Tile, uint32_t Offset, uint32_t StartPixel, uint32_t Width, uint32_t StartLine, uint32_t LineCount, uint8_t Flags)
+{
+    uint8_t *pCache, *bp, Pix;
+    int32_t l, bp_step;
+    uint32_t endpix, i;
+    GET_CACHED_TILE();
+    if (IS_BLANK_TILE())
+        return;
+    SELECT_PALETTE();
+    if (GFX.ClipColors)
+        Flags |= LAYER_CLIP;
+    endpix = StartPixel + Width;
+    if (endpix > 8) endpix = 8;
+    if (!(Tile & V_FLIP))
+    {
+        bp = pCache + StartLine;
+        bp_step = 8;
+    }
+    else
+    {
+        bp = pCache + 56 - StartLine;
+        bp_step = -8;
+    }
+    for (l = LineCount; l > 0; l--, bp += bp_step, Offset += GFX.PPL)
+    {
+        if (!(Tile & H_FLIP))
+        {
+            for (i = StartPixel; i < endpix; i++)
+                DRAW_PIXEL_LAYERED(i, Pix = bp[i])
+        }
+        else
+        {
+            for (i = StartPixel; i < endpix; i++)
+                DRAW_PIXEL_LAYERED(i, Pix = bp[7 - i])
+        }
+    }
+}
+
+static INLINE void DrawBackdrop16Layered (uint32_t Offset, uint32_t Left, uint32_t Right, uint8_t Flags)
+{
+    uint32_t l, x;
+    uint16_t fill_color = GFX.RealScreenColors[0];
+    if (GFX.ClipColors)
+        Flags |= LAYER_CLIP;
+    for (l = GFX.StartY; l <= GFX.EndY; l++, Offset += GFX.PPL)
+    {
+        for (x = Left; x < Right; x++)
+        {
+            if (GFX.DB[Offset + x] == 0)
+            {
+                GFX.S[Offset + x] = fill_color;
+                GFX.LF[Offset + x] = Flags;
+                GFX.DB[Offset + x] = 1;
+            }
+        }
+    }
+}
+
+#undef DRAW_PIXEL_LAYERED
+
+static void DrawTile16_Layered (uint32_t Tile, uint32_t Offset, uint32_t StartLine, uint32_t LineCount)
+{
+    DrawTile16Layered(Tile, Offset, StartLine, LineCount, 0);
+}
+
+static void DrawTile16Math_Layered (uint32_t Tile, uint32_t Offset, uint32_t StartLine, uint32_t LineCount)
+{
+    DrawTile16Layered(Tile, Offset, StartLine, LineCount, LAYER_MATH);
+}
+
+static void DrawClippedTile16_Layered (uint32_t Tile, uint32_t Offset, uint32_t StartPixel, uint32_t Width, uint32_t StartLine, uint32_t LineCount)
+{
+    DrawClippedTile16Layered(Tile, Offset, StartPixel, Width, StartLine, LineCount, 0);
+}
+
+static void DrawClippedTile16Math_Layered (uint32_t Tile, uint32_t Offset, uint32_t StartPixel, uint32_t Width, uint32_t StartLine, uint32_t LineCount)
+{
+    DrawClippedTile16Layered(Tile, Offset, StartPixel, Width, StartLine, LineCount, LAYER_MATH);
+}
+
+static void DrawBackdrop16_Layered (uint32_t Offset, uint32_t Left, uint32_t Right)
+{
+    DrawBackdrop16Layered(Offset, Left, Right, 0);
+}
+
+static void DrawBackdrop16Math_Layered (uint32_t Offset, uint32_t Left, uint32_t Right)
+{
+    DrawBackdrop16Layered(Offset, Left, Right, LAYER_MATH);
+}
+
+/* Phase 2: the compositor. One native line in, one output row out at
+ * PixWidth copies per pixel. Per pixel this is exactly what the
+ * direct Math plotter of the same op index would have stored:
+ *   Main = LAYER_CLIP ? 0 : colour  (BlackColourMap)
+ *   !LAYER_MATH          -> Main
+ *   REGMATH  (1, 4, 7)   -> Op(Main, SD & 0x20 ? Sub : Fixed)
+ *   MATHF1_2 (2, 5)      -> clip ? Op(Main, Fixed) : Op1_2(Main, Fixed)
+ *   MATHS1_2 (3, 6, 8)   -> clip ? REGMATH
+ *                               : SD & 0x20 ? Op1_2(Main, Sub) : Op(Main, Fixed)
+ * The brightness-capped slots 7/8 stay scalar (table lookup); the
+ * others run eight pixels at a time on the shared SIMD primitives. */
+
+static INLINE uint16_t tile_composite_pixel (uint8_t op, uint16_t Main, uint16_t Sub, uint8_t SD, uint16_t Fixed, uint8_t Flags)
+{
+    uint8_t  clip    = Flags & LAYER_CLIP;
+    uint16_t operand = (SD & 0x20) ? Sub : Fixed;
+
+    if (clip)
+        Main = 0;
+    if (!(Flags & LAYER_MATH))
+        return (Main);
+
+    switch (op)
+    {
+        case 1: return (COLOR_ADD(Main, operand));
+        case 2: return (clip ? COLOR_ADD(Main, Fixed) : COLOR_ADD1_2(Main, Fixed));
+        case 3: return ((clip || !(SD & 0x20)) ? COLOR_ADD(Main, operand) : COLOR_ADD1_2(Main, Sub));
+        case 4: return (COLOR_SUB(Main, operand));
+        case 5: return (clip ? COLOR_SUB(Main, Fixed) : COLOR_SUB1_2(Main, Fixed));
+        case 6: return ((clip || !(SD & 0x20)) ? COLOR_SUB(Main, operand) : COLOR_SUB1_2(Main, Sub));
+        case 7: return (COLOR_ADD_BRIGHTNESS(Main, operand));
+        case 8: return ((clip || !(SD & 0x20)) ? COLOR_ADD_BRIGHTNESS(Main, operand) : COLOR_ADD_BRIGHTNESS1_2(Main, Sub));
+    }
+
+    return (Main);
+}
+
+#if defined(TILE_HAVE_SSE2)
+static INLINE __m128i tile_composite8_sse2 (uint8_t op, const uint16_t *main_p, const uint16_t *sub_p,
+                                            const uint8_t *sd_p, const uint8_t *flags_p, __m128i vFixed)
+{
+    const __m128i vClip = _mm_set1_epi8(LAYER_CLIP);
+    const __m128i vMath = _mm_set1_epi8(LAYER_MATH);
+    const __m128i v20   = _mm_set1_epi8(0x20);
+    __m128i flags   = _mm_loadl_epi64((const __m128i *) flags_p);
+    __m128i sd      = _mm_loadl_epi64((const __m128i *) sd_p);
+    __m128i vSub    = _mm_loadu_si128((const __m128i *) sub_p);
+    __m128i clip8   = _mm_cmpeq_epi8(_mm_and_si128(flags, vClip), vClip);
+    __m128i math8   = _mm_cmpeq_epi8(_mm_and_si128(flags, vMath), vMath);
+    __m128i sd8     = _mm_cmpeq_epi8(_mm_and_si128(sd, v20), v20);
+    __m128i clip16  = _mm_unpacklo_epi8(clip8, clip8);
+    __m128i math16  = _mm_unpacklo_epi8(math8, math8);
+    __m128i half16  = _mm_andnot_si128(clip16, _mm_unpacklo_epi8(sd8, sd8));
+    __m128i vMain   = _mm_andnot_si128(clip16, _mm_loadu_si128((const __m128i *) main_p));
+    __m128i operand = tile_select_sub_or_fixed_sse2(sd, vSub, vFixed);
+    __m128i pix;
+
+    switch (op)
+    {
+        case 1:
+            pix = tile_color_add_sse2(vMain, operand);
+            break;
+        case 2:
+            pix = _mm_or_si128(_mm_and_si128(clip16, tile_color_add_sse2(vMain, vFixed)),
+                               _mm_andnot_si128(clip16, tile_color_add_half_sse2(vMain, vFixed)));
+            break;
+        case 3:
+            pix = _mm_or_si128(_mm_and_si128(half16, tile_color_add_half_sse2(vMain, vSub)),
+                               _mm_andnot_si128(half16, tile_color_add_sse2(vMain, operand)));
+            break;
+        case 4:
+            pix = tile_color_sub_sse2(vMain, operand);
+            break;
+        case 5:
+            pix = _mm_or_si128(_mm_and_si128(clip16, tile_color_sub_sse2(vMain, vFixed)),
+                               _mm_andnot_si128(clip16, tile_color_sub_half_sse2(vMain, vFixed)));
+            break;
+        case 6:
+            pix = _mm_or_si128(_mm_and_si128(half16, tile_color_sub_half_sse2(vMain, vSub)),
+                               _mm_andnot_si128(half16, tile_color_sub_sse2(vMain, operand)));
+            break;
+        default:
+            pix = vMain;
+            break;
+    }
+
+    return (_mm_or_si128(_mm_and_si128(math16, pix), _mm_andnot_si128(math16, vMain)));
+}
+#elif defined(TILE_HAVE_NEON)
+static INLINE uint16x8_t tile_composite8_neon (uint8_t op, const uint16_t *main_p, const uint16_t *sub_p,
+                                               const uint8_t *sd_p, const uint8_t *flags_p, uint16x8_t vFixed)
+{
+    uint8x8_t  flags   = vld1_u8(flags_p);
+    uint8x8_t  sd      = vld1_u8(sd_p);
+    uint16x8_t vSub    = vld1q_u16(sub_p);
+    uint16x8_t clip16  = vreinterpretq_u16_u8(tile_neon_dup_each_byte(vtst_u8(flags, vdup_n_u8(LAYER_CLIP))));
+    uint16x8_t math16  = vreinterpretq_u16_u8(tile_neon_dup_each_byte(vtst_u8(flags, vdup_n_u8(LAYER_MATH))));
+    uint16x8_t sd16    = vreinterpretq_u16_u8(tile_neon_dup_each_byte(vtst_u8(sd, vdup_n_u8(0x20))));
+    uint16x8_t half16  = vbicq_u16(sd16, clip16);
+    uint16x8_t vMain   = vbicq_u16(vld1q_u16(main_p), clip16);
+    uint16x8_t operand = tile_select_sub_or_fixed_neon(sd, vSub, vFixed);
+    uint16x8_t pix;
+
+    switch (op)
+    {
+        case 1:
+            pix = tile_color_add_neon(vMain, operand);
+            break;
+        case 2:
+            pix = vbslq_u16(clip16, tile_color_add_neon(vMain, vFixed), tile_color_add_half_neon(vMain, vFixed));
+            break;
+        case 3:
+            pix = vbslq_u16(half16, tile_color_add_half_neon(vMain, vSub), tile_color_add_neon(vMain, operand));
+            break;
+        case 4:
+            pix = tile_color_sub_neon(vMain, operand);
+            break;
+        case 5:
+            pix = vbslq_u16(clip16, tile_color_sub_neon(vMain, vFixed), tile_color_sub_half_neon(vMain, vFixed));
+            break;
+        case 6:
+            pix = vbslq_u16(half16, tile_color_sub_half_neon(vMain, vSub), tile_color_sub_neon(vMain, operand));
+            break;
+        default:
+            pix = vMain;
+            break;
+    }
+
+    return (vbslq_u16(math16, pix, vMain));
+}
+#endif
 
-	i = (tile_FillRAM[0x2131] & 0x80) ? 4 : 1;
+uint8 S9xTileMathOp (void)
+{
+	/* Color math op selector. Indices into the per-renderer function
+	 * tables: 0 = no math, 1 = Add, 2 = AddF1_2, 3 = AddS1_2,
+	 * 4 = Sub, 5 = SubF1_2, 6 = SubS1_2. CGADSUB ($2131) bits decide
+	 * which op is active this frame. */
+	uint8 i = (tile_FillRAM[0x2131] & 0x80) ? 4 : 1;
 	if (tile_FillRAM[0x2131] & 0x40)
 	{
 		i++;
@@ -36834,6 +33446,97 @@ void S9xSelectTileRenderers_SFXSpeedup (void)
 			i = 8;
 	}
 
+	return (i);
+}
+
+void S9xCompositeLayerLine (uint32 Line, uint16 *Out, uint32 PixWidth)
+{
+    const uint16_t *m     = GFX.LayerScreen     + Line * SNES_WIDTH;
+    const uint16_t *s     = GFX.LayerSubScreen  + Line * SNES_WIDTH;
+    const uint8_t  *sd    = GFX.LayerSubZBuffer + Line * SNES_WIDTH;
+    const uint8_t  *flags = GFX.LayerFlags      + Line * SNES_WIDTH;
+    uint8_t         op    = GFX.LayerLines[Line].MathOp;
+    uint16_t        fixed = GFX.LayerLines[Line].FixedColour;
+    uint32_t        x     = 0;
+
+#if defined(TILE_HAVE_SSE2)
+    if (op < 7)
+    {
+        const __m128i vFixed = _mm_set1_epi16((short) fixed);
+        for (; x < SNES_WIDTH; x += 8)
+        {
+            __m128i pix = tile_composite8_sse2(op, m + x, s + x, sd + x, flags + x, vFixed);
+            if (PixWidth == 1)
+                _mm_storeu_si128((__m128i *) (Out + x), pix);
+            else
+            {
+                __m128i lo = _mm_unpacklo_epi16(pix, pix);
+                __m128i hi = _mm_unpackhi_epi16(pix, pix);
+                if (PixWidth == 2)
+                {
+                    _mm_storeu_si128((__m128i *) (Out + x * 2),     lo);
+                    _mm_storeu_si128((__m128i *) (Out + x * 2 + 8), hi);
+                }
+                else
+                {
+                    _mm_storeu_si128((__m128i *) (Out + x * 4),      _mm_unpacklo_epi32(lo, lo));
+                    _mm_storeu_si128((__m128i *) (Out + x * 4 + 8),  _mm_unpackhi_epi32(lo, lo));
+                    _mm_storeu_si128((__m128i *) (Out + x * 4 + 16), _mm_unpacklo_epi32(hi, hi));
+                    _mm_storeu_si128((__m128i *) (Out + x * 4 + 24), _mm_unpackhi_epi32(hi, hi));
+                }
+            }
+        }
+    }
+#elif defined(TILE_HAVE_NEON)
+    if (op < 7)
+    {
+        const uint16x8_t vFixed = vdupq_n_u16(fixed);
+        for (; x < SNES_WIDTH; x += 8)
+        {
+            uint16x8_t pix = tile_composite8_neon(op, m + x, s + x, sd + x, flags + x, vFixed);
+            if (PixWidth == 1)
+                vst1q_u16(Out + x, pix);
+            else if (PixWidth == 2)
+            {
+                uint16x8x2_t d = { { pix, pix } };
+                vst2q_u16(Out + x * 2, d);
+            }
+            else
+            {
+                uint16x8x4_t q = { { pix, pix, pix, pix } };
+                vst4q_u16(Out + x * 4, q);
+            }
+        }
+    }
+#endif
+
+    for (; x < SNES_WIDTH; x++)
+    {
+        uint16_t pix = tile_composite_pixel(op, m[x], s[x], sd[x], fixed, flags[x]);
+        uint32_t k;
+        for (k = 0; k < PixWidth; k++)
+            Out[x * PixWidth + k] = pix;
+    }
+}
+
+/* ====================================================================
+ * Dispatch helpers: select renderer pointers based on PPU state
+ * ==================================================================== */
+
+
+/* Functions to select which converter and renderer to use. */
+
+void S9xSelectTileRenderers_SFXSpeedup (void)
+{
+	int i;
+	GFX.LinesPerTile = 8;
+
+	GFX.DrawTileNomath        = Renderers_DrawTile16Normal1x1[0];
+	GFX.DrawClippedTileNomath = Renderers_DrawClippedTile16Normal1x1[0];
+	GFX.DrawBackdropNomath    = Renderers_DrawBackdrop16Normal1x1[0];
+
+	i = S9xTileMathOp();
+
 	GFX.DrawTileMath        = Renderers_DrawTile16Normal1x1[i];
 	GFX.DrawClippedTileMath = Renderers_DrawClippedTile16Normal1x1[i];
 	GFX.DrawBackdropMath    = Renderers_DrawBackdrop16Normal1x1[i];
@@ -37002,30 +33705,7 @@ void S9xSelectTileRenderers (int BGMode, uint8_t sub, uint8_t obj)
 	GFX.DrawMode7BG1Nomath    = DM7BG1[0];
 	GFX.DrawMode7BG2Nomath    = DM7BG2[0];
 
-	/* Color math op selector. Indices into the per-renderer function
-	 * tables: 0 = no math, 1 = Add, 2 = AddF1_2, 3 = AddS1_2,
-	 * 4 = Sub, 5 = SubF1_2, 6 = SubS1_2. CGADSUB ($2131) bits decide
-	 * which op is active this frame. */
-	i = (tile_FillRAM[0x2131] & 0x80) ? 4 : 1;
-	if (tile_FillRAM[0x2131] & 0x40)
-	{
-		i++;
-		if (tile_FillRAM[0x2130] & 2)
-			i++;
-	}
-
-	/* ScreenColors are pre-scaled by master brightness, so the additive
-	 * full-strength paths must clamp at the scaled maximum; slots 7/8
-	 * are the brightness-capped clones of slots 1/3 (see
-	 * COLOR_ADD_BRIGHTNESS). Mirrors mainline's IPPU.MaxBrightness
-	 * selection; PPU.Brightness carries the same value here. */
-	if (PPU.Brightness != 0xf)
-	{
-		if (i == 1)
-			i = 7;
-		else if (i == 3)
-			i = 8;
-	}
+	i = S9xTileMathOp();
 
 	GFX.DrawTileMath        = DT[i];
 	GFX.DrawClippedTileMath = DCT[i];
@@ -37034,6 +33714,21 @@ void S9xSelectTileRenderers (int BGMode, uint8_t sub, uint8_t obj)
 	GFX.DrawMode7BG1Math    = DM7BG1[i];
 	GFX.DrawMode7BG2Math    = DM7BG2[i];
 
+	/* Phase 1 of the two-phase renderer: the layer rows are native
+	 * width and color math is resolved later by the compositor, so
+	 * the BG/OBJ/backdrop plotters are replaced wholesale. RenderScreen
+	 * only sets GFX.Layered for modes 0-4 without mosaic, so Mode 7
+	 * and mosaic pointers are never reached. */
+	if (GFX.Layered)
+	{
+		GFX.DrawTileNomath        = DrawTile16_Layered;
+		GFX.DrawClippedTileNomath = DrawClippedTile16_Layered;
+		GFX.DrawBackdropNomath    = DrawBackdrop16_Layered;
+		GFX.DrawTileMath          = DrawTile16Math_Layered;
+		GFX.DrawClippedTileMath   = DrawClippedTile16Math_Layered;
+		GFX.DrawBackdropMath      = DrawBackdrop16Math_Layered;
+	}
+
 	S9xHdPackWrapRenderers(DT == Renderers_DrawTile16Normal1x1);
 }
 
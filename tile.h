@@ -17,7 +17,9 @@ void S9xInitTileRenderer (void);
 void S9xSelectTileRenderers (int, uint8, uint8);
 void S9xSelectTileConverter (int, uint8, uint8, uint8);
 void S9xSelectTileRenderers_SFXSpeedup (void);
-void S9xMode7DeinterleaveVRAM (void);
+void S9xMode7DeinterleaveVRAM (uint8 *);
+uint8 S9xTileMathOp (void);
+void S9xCompositeLayerLine (uint32, uint16 *, uint32);
 
 #ifdef __cplusplus
 }